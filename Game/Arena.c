@@ -0,0 +1,63 @@
+/*
+ * Scratch arena implementation
+ */
+
+#include "Arena.h"
+
+uint8_t arenaData[ARENA_SIZE];
+uint16_t arenaUsed;
+uint16_t arenaHighWater;
+
+/*
+ * Releases everything allocated from the arena
+ */
+void ArenaReset()
+{
+    arenaUsed = 0;
+}
+
+/*
+ * Allocates a buffer from the arena or returns NULL if there is not enough
+ * space left
+ */
+void *ArenaAlloc(uint16_t size)
+{
+    if(size > (ARENA_SIZE - arenaUsed))
+    {
+        return NULL;
+    }
+
+    void *p = &arenaData[arenaUsed];
+    arenaUsed += size;
+
+    if(arenaUsed > arenaHighWater)
+    {
+        arenaHighWater = arenaUsed;
+    }
+
+    return p;
+}
+
+/*
+ * Returns a mark that can later be passed to ArenaRelease
+ */
+uint16_t ArenaMark()
+{
+    return arenaUsed;
+}
+
+/*
+ * Releases everything allocated since the mark was taken
+ */
+void ArenaRelease(uint16_t mark)
+{
+    arenaUsed = mark;
+}
+
+/*
+ * Returns the largest number of bytes that have been in use at once
+ */
+uint16_t ArenaHighWater()
+{
+    return arenaHighWater;
+}
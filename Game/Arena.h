@@ -0,0 +1,28 @@
+/*
+ * Scratch arena for transient buffers
+ *
+ * A bump-pointer allocator over one static buffer that is shared by path
+ * finding and text formatting. Callers take a mark before allocating and
+ * release back to it when done, and the arena is reset on every pass of the
+ * main loop. The highest offset reached is kept to size the arena.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Sized for the largest user, the visited points of a path search (120 of 2
+ * bytes). Nothing else is allocated while a search is running.
+ */
+#define ARENA_SIZE 240
+
+void ArenaReset();
+void *ArenaAlloc(uint16_t size);
+uint16_t ArenaMark();
+void ArenaRelease(uint16_t mark);
+uint16_t ArenaHighWater();
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * Map cell implementation
+ */
+
+#include "Cell.h"
+
+/*
+ * Bitmap of cells on the edge of the map, generated into Map.h by MapTools
+ */
+extern const uint8_t mapEdgeCells[] PROGMEM;
+
+/*
+ * Cell index deltas for each direction
+ */
+const int8_t cellDeltas[] PROGMEM = { -MAP_WIDTH, 1, MAP_WIDTH, -1 };
+
+/*
+ * Converts a point into a cell, or CELL_NONE if it is off the map
+ */
+Cell_t CellFromPoint(const Point_t p)
+{
+    if(p.X >= MAP_WIDTH || p.Y >= MAP_HEIGHT)
+    {
+        return CELL_NONE;
+    }
+
+    return CELL_XY(p.X, p.Y);
+}
+
+/*
+ * Converts a cell back into a point
+ */
+Point_t CellToPoint(const Cell_t cell)
+{
+    uint8_t y = ((uint32_t)cell * CELL_ROW_RECIPROCAL) >> CELL_ROW_SHIFT;
+    Point_t p = { .X = cell - CELL_XY(0, y), .Y = y };
+    return p;
+}
+
+/*
+ * Returns a bool indicating whether a cell is on the edge of the map
+ */
+bool CellIsEdge(const Cell_t cell)
+{
+    return (pgm_read_byte(&(mapEdgeCells[cell >> 3])) >> (cell & 0x07)) & 0x01;
+}
+
+/*
+ * Gets the neighbouring cell in a direction or CELL_NONE if that would leave
+ * the map. Only cells on the edge need their coordinates checked.
+ */
+Cell_t CellNeighbor(const Cell_t cell, const Direction_t d)
+{
+    if(CellIsEdge(cell))
+    {
+        Point_t p = CellToPoint(cell);
+
+        if((d == Direction_North && p.Y == 0)
+            || (d == Direction_East && p.X == (MAP_WIDTH - 1))
+            || (d == Direction_South && p.Y == (MAP_HEIGHT - 1))
+            || (d == Direction_West && p.X == 0))
+        {
+            return CELL_NONE;
+        }
+    }
+
+    return cell + (int8_t)pgm_read_byte(&(cellDeltas[d]));
+}
+
+/*
+ * Returns the manhattan distance between two cells
+ */
+uint8_t CellDistance(const Cell_t c1, const Cell_t c2)
+{
+    return PointDistance(CellToPoint(c1), CellToPoint(c2));
+}
+
+/*
+ * Returns the longest axis difference between two cells
+ */
+uint8_t CellLongestAxis(const Cell_t c1, const Cell_t c2)
+{
+    return PointLongestAxis(CellToPoint(c1), CellToPoint(c2));
+}
+
+/*
+ * Returns the manhattan distance between two cells if it is under the range,
+ * or the range if not. The offset between the cells is split into rows by
+ * stepping a row at a time, so the range is meant to be small. The column of
+ * the first cell tells a short step sideways from one that wraps around the
+ * edge of the map.
+ */
+uint8_t CellNearDistance(const Cell_t c1, const uint8_t x1, const Cell_t c2,
+    const uint8_t range)
+{
+    int16_t offset = c2 - c1;
+    uint8_t rows = 0;
+
+    while(offset > MAP_WIDTH / 2 && rows < range)
+    {
+        offset -= MAP_WIDTH;
+        rows++;
+    }
+
+    while(offset < -(MAP_WIDTH / 2) && rows < range)
+    {
+        offset += MAP_WIDTH;
+        rows++;
+    }
+
+    int16_t x2 = x1 + offset;
+    uint8_t columns = (offset < 0) ? -offset : offset;
+
+    if(x2 < 0 || x2 >= MAP_WIDTH || rows + columns >= range)
+    {
+        return range;
+    }
+
+    return rows + columns;
+}
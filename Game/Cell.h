@@ -0,0 +1,45 @@
+/*
+ * Map cells
+ *
+ * A cell is the linear index of a tile on the map. Neighbouring cells are
+ * found by adding a precomputed delta, and a bitmap generated by MapTools
+ * flags the cells on the edge of the map where a delta could step off it.
+ * Points are only needed where cells meet the screen.
+ */
+
+#ifndef CELL_H
+#define CELL_H
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Bool.h"
+#include "Direction.h"
+#include "Point.h"
+
+#define MAP_WIDTH 121
+#define MAP_HEIGHT 48
+
+#define CELL_COUNT (MAP_WIDTH * MAP_HEIGHT)
+#define CELL_NONE 0xFFFF
+#define CELL_XY(x, y) (((y) * MAP_WIDTH) + (x))
+
+/*
+ * The row of a cell is found by multiplying with this fixed point reciprocal
+ * of MAP_WIDTH rather than dividing, which is exact for every cell on the map
+ */
+#define CELL_ROW_SHIFT 19
+#define CELL_ROW_RECIPROCAL (((1UL << CELL_ROW_SHIFT) / MAP_WIDTH) + 1)
+
+typedef uint16_t Cell_t;
+
+Cell_t CellFromPoint(const Point_t p);
+Point_t CellToPoint(const Cell_t cell);
+bool CellIsEdge(const Cell_t cell);
+Cell_t CellNeighbor(const Cell_t cell, const Direction_t d);
+uint8_t CellDistance(const Cell_t c1, const Cell_t c2);
+uint8_t CellLongestAxis(const Cell_t c1, const Cell_t c2);
+uint8_t CellNearDistance(const Cell_t c1, const uint8_t x1, const Cell_t c2,
+    const uint8_t range);
+
+#endif
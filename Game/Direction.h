@@ -12,4 +12,6 @@ typedef enum Direction_t {
     Direction_West
 } Direction_t;
 
+#define DIRECTION_OPPOSITE(d) ((Direction_t)(((d) + 2) & 3))
+
 #endif
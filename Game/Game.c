@@ -7,27 +7,78 @@
 
 /* Constants ******************************************************************/
 
-const Point_t basePosition = { .X = 51, .Y = 31 };
+#define BASE_X 51
+#define BASE_Y 31
+const Point_t basePosition = { .X = BASE_X, .Y = BASE_Y };
+const Cell_t baseCell = CELL_XY(BASE_X, BASE_Y);
 
 #define LEVEL_COUNT 1
 const LevelSpec_t levels[] PROGMEM = {{ .LevelName = "Beginners Luck",
+                                        .MoveSpeed = 8,
                                         .HealthPoints = 10,
+                                        .AttackSpeed = 8,
                                         .KillReward = 10 }};
 
 #define ENTRY_POINT_COUNT 8
-const Point_t entryPoints[] = {{ .X = 23, .Y = 0 },
-                               { .X = 107, .Y = 0},
-                               { .X = 0, .Y = 15},
-                               { .X = 0, .Y = 22},
-                               { .X = 24, .Y = 47},
-                               { .X = 109, .Y = 47},
-                               { .X = 120, .Y = 41},
-                               { .X = 120, .Y = 31}};
+const Cell_t entryCells[] = { CELL_XY(23, 0),
+                              CELL_XY(107, 0),
+                              CELL_XY(0, 15),
+                              CELL_XY(0, 22),
+                              CELL_XY(24, 47),
+                              CELL_XY(109, 47),
+                              CELL_XY(120, 41),
+                              CELL_XY(120, 31) };
+
+const char GoldLabel[] PROGMEM = "Gold ";
+const char LevelLabel[] PROGMEM = "Level ";
+const char BotsLabel[] PROGMEM = "Bots ";
+#ifdef HUD_PERF
+const char ScratchLabel[] PROGMEM = "Scratch ";
+#endif
+
+#define HUD_LABEL(label, width) { label, sizeof(label) - 1, width }
+
+/*
+ * The fields of the top border, indexed by HudFieldId_t
+ */
+const HudField_t hudFields[] PROGMEM = {
+    HUD_LABEL(GoldLabel, 6),
+    HUD_LABEL(LevelLabel, 2),
+    HUD_LABEL(BotsLabel, 3),
+#ifdef HUD_PERF
+    HUD_LABEL(ScratchLabel, 4),
+#endif
+};
+
+#define HUD_GAP 2
+
+/*
+ * Colors of everything drawn on the map. Tiles are indexed by TileType_t
+ * and followed by the entity styles.
+ */
+const TermStyle_t glyphStyles[] PROGMEM = {
+    TERM_STYLE(TermColor_000000, TermColor_000000,
+        "\x1b[38;5;16;48;5;16m"),
+    TERM_STYLE(TermColor_606060, TermColor_3A3A3A,
+        "\x1b[38;5;241;48;5;237m"),
+    TERM_STYLE(TermColor_00AFFF, TermColor_005FFF,
+        "\x1b[38;5;39;48;5;27m"),
+    TERM_STYLE(TermColor_5FFF00, TermColor_00AF00,
+        "\x1b[38;5;82;48;5;34m"),
+    TERM_STYLE(TermColor_FFFFFF, COLOR_BASE,
+        "\x1b[38;5;15;48;5;178m"),
+    TERM_STYLE(COLOR_BOT_FG, COLOR_BOT_BG,
+        "\x1b[38;5;202;48;5;160m"),
+    TERM_STYLE(COLOR_TOWER_FG, COLOR_TOWER_BG,
+        "\x1b[38;5;15;48;5;129m")
+};
 
 const char TowerBuilt[] PROGMEM = "Tower Built Successfully";
 const char TowerNotBuilt[] PROGMEM = "Cannot Build Here";
 const char TowerLimitExceeded[] PROGMEM = "Tower Limit Exceeded";
 const char MoreGoldRequired[] PROGMEM = "More Gold Required";
+const char BotHealthFormat[] PROGMEM = "%uHP";
+const char ScratchFormat[] PROGMEM = "Scratch %u/%u";
 
 /* Game Variables *************************************************************/
 
@@ -41,13 +92,78 @@ uint8_t level;
 
 uint8_t botStep;
 uint8_t botCount;
+uint8_t botsAlive;
 uint8_t towerCount;
-Bot_t bots[MAX_BOTS];
 Tower_t towers[MAX_TOWERS];
 
-#define VISITED_POINTS_COUNT 120
+Cell_t botCells[MAX_BOTS];
+uint8_t botState[MAX_BOTS];
+
+TimingWheel_t wheel;
+uint8_t entityNext[ENTITY_COUNT];
+uint8_t entityDue[WHEEL_DUE_SIZE(ENTITY_COUNT)];
+
+// Parked bots are linked through entityNext as they are not on the wheel
+uint8_t waitHeads[WAIT_BUCKETS];
+
+// Map cells changed by the simulation since the last frame
+Cell_t dirtyCells[DIRTY_CELLS];
+uint8_t dirtyIds[DIRTY_CELLS];
+uint8_t dirtyCount = 0;
+
+// The render profile and what the link has been doing since it was chosen
+RenderProfile_t renderProfile = Profile_Full;
+bool linkBehind = FALSE;
+uint16_t linkBytesSent;
+uint16_t linkCapacity;
+uint16_t linkUsage;
+uint8_t linkBehindSteps;
+uint16_t linkIdleSteps;
+uint8_t profileStep;
+
+// Idle steps needed to step up, which backs off each time the profile drops
+uint16_t profileUpSteps = PROFILE_UP_STEPS;
+uint16_t profileHeldSteps;
+bool profileRaised = FALSE;
+
+// Room kept back for the next frame while drawing between frames
+uint8_t linkReserve = 0;
+
+// The control sequence being received from the terminal
+InputSequence_t inputSequence;
+
+// Map cells still to be drawn, across as many frames as the link needs
+MapJob_t mapJob;
+MapJob_t spillJobs[SPILL_JOBS];
+
+// Set when the whole screen is to be cleared and drawn again
+bool repaintScreen = TRUE;
+
+// The columns the rows of the view are being shifted by without margins and
+// the next row to shift, panShift is zero when no shift is under way
+int8_t panShift = 0;
+uint8_t panRow;
+
+// The next row to erase after a resize, zero when none is under way
+uint8_t resizeRow = 0;
+Size_t resizeSize;
+
+// The fields of the top border as they are on screen and those to update
+char hudText[Hud_FieldCount][HUD_FIELD_WIDTH];
+uint8_t hudDirty;
+
+// The view position the map on screen is drawn for, behind viewPosition
+// until a pan has been sent
+Point_t screenView;
+
+// The window size the screen is laid out for and where the last frame left
+// the cursor
+Size_t screenSize;
+Point_t screenCursor;
+
+// The visited points of a search are allocated from the scratch arena
 uint8_t visitedPointsCount = 0;
-VisitedPoint_t visitedPoints[VISITED_POINTS_COUNT];
+VisitedPoint_t *visitedPoints = NULL;
 
 
 /* Game Functions *************************************************************/
@@ -57,19 +173,7 @@ VisitedPoint_t visitedPoints[VISITED_POINTS_COUNT];
  */
 TermColor_t GameGetTileBgColor(const TileType_t t)
 {
-    switch(t)
-    {
-        case Tile_Stone:
-            return TermColor_3A3A3A;
-        case Tile_Water:
-            return TermColor_005FFF;
-        case Tile_Grass:
-            return TermColor_00AF00;
-        case Tile_Empty:
-            return TermColor_000000;
-        default:
-            return TermColor_262626;
-    }
+    return pgm_read_byte(&(glyphStyles[t].Bg));
 }
 
 /*
@@ -77,19 +181,7 @@ TermColor_t GameGetTileBgColor(const TileType_t t)
  */
 TermColor_t GameGetTileFgColor(const TileType_t t)
 {
-    switch(t)
-    {
-        case Tile_Stone:
-            return TermColor_606060;
-        case Tile_Water:
-            return TermColor_00AFFF;
-        case Tile_Grass:
-            return TermColor_5FFF00;
-        case Tile_Empty:
-            return TermColor_000000;
-        default:
-            return TermColor_262626;
-    }
+    return pgm_read_byte(&(glyphStyles[t].Fg));
 }
 
 /*
@@ -113,23 +205,71 @@ char GameGetTileCharacter(const TileType_t t)
 }
 
 /*
- * Gets the type of map tile given a point
+ * Gets the type of map tile given a cell
+ */
+TileType_t GameGetTile(const Cell_t cell)
+{
+    uint8_t tile = pgm_read_byte(&(mapTiles[cell >> 2]));
+    return (tile >> ((cell & 0b11) << 1)) & 0b11;
+}
+
+/*
+ * Selects the walkable tile with the given index, counting walkable tiles in
+ * row-major order. The row is found from the rank table generated by
+ * MapTools, then the row is scanned for the tile.
+ */
+Cell_t GameWalkableCell(const uint16_t index)
+{
+    uint8_t low = 0;
+    uint8_t high = MAP_HEIGHT;
+
+    while(high - low > 1)
+    {
+        uint8_t mid = (low + high) / 2;
+
+        if(pgm_read_word(&(mapWalkableRank[mid])) <= index)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    uint16_t remaining = index - pgm_read_word(&(mapWalkableRank[low]));
+    Cell_t cell = CELL_XY(0, low);
+    Cell_t rowEnd = cell + MAP_WIDTH - 1;
+
+    for(; cell < rowEnd; cell++)
+    {
+        if(GameGetTile(cell) != Tile_Stone && remaining-- == 0)
+        {
+            break;
+        }
+    }
+
+    return cell;
+}
+
+/*
+ * Gets the walking distance from a cell to the base over the terrain from
+ * the distance field generated by MapTools. Towers are not taken into
+ * account.
  */
-TileType_t GameGetTile(const Point_t p)
+uint8_t GameBaseDistance(const Cell_t cell)
 {
-    uint16_t tileNum = (p.Y * MAP_WIDTH) + p.X;
-    uint8_t tile = pgm_read_byte(&(mapTiles[tileNum >> 2]));
-    return (tile >> ((tileNum & 0b11) << 1)) & 0b11;
+    return pgm_read_byte(&(mapBaseDistance[cell]));
 }
 
 /*
- * Gets a tower given a point
+ * Gets a tower given a cell
  */
-Tower_t *GameTowerByPoint(Point_t p)
+Tower_t *GameTowerByCell(const Cell_t cell)
 {
     for(uint8_t i = 0; i < towerCount; i++)
     {
-        if(PointsEqual(towers[i].Position, p))
+        if(towers[i].Cell == cell)
         {
             return &towers[i];
         }
@@ -161,6 +301,8 @@ uint8_t GameTowerAttackDamage(Tower_t *tower)
  */
 void GameNewTower()
 {
+    Cell_t cursorCell = CellFromPoint(cursorPosition);
+
     if(towerCount >= MAX_TOWERS)
     {
         GameRenderStatusP(TowerLimitExceeded);
@@ -169,9 +311,10 @@ void GameNewTower()
     {
         GameRenderStatusP(MoreGoldRequired);
     }
-    else if(GameGetTile(cursorPosition) == Tile_Stone
-        || GameTowerByPoint(cursorPosition)
-        || PointsEqual(cursorPosition, basePosition)
+    else if(cursorCell == CELL_NONE
+        || GameGetTile(cursorCell) == Tile_Stone
+        || GameTowerByCell(cursorCell)
+        || cursorCell == baseCell
         || cursorPosition.X < viewPosition.X
         || cursorPosition.X >= (viewPosition.X + windowSize.Width)
         || cursorPosition.Y < viewPosition.Y
@@ -181,9 +324,9 @@ void GameNewTower()
     }
     else
     {
-        Bot_t *bot = GameBotByPoint(cursorPosition);
+        uint8_t bot = GameBotByCell(cursorCell);
         
-        if(bot != NULL && bot->HealthPoints > 0)
+        if(bot != BOT_NONE && BOT_HEALTH(botState[bot]) > 0)
         {
             GameRenderStatusP(TowerNotBuilt);
             return;
@@ -191,21 +334,24 @@ void GameNewTower()
         
         for(uint8_t i = 0; i < ENTRY_POINT_COUNT; i++)
         {
-            if(PointsEqual(entryPoints[i], cursorPosition))
+            if(entryCells[i] == cursorCell)
             {
                 GameRenderStatusP(TowerNotBuilt);
                 return;
             }
         }
         
-        towers[towerCount].Position = cursorPosition;
+        GameMarkDirty(cursorCell);
+        towers[towerCount].Cell = cursorCell;
         towers[towerCount].Level = 1;
         
-        GameRenderTower(&towers[towerCount++]);
-        GameRenderBorders();
+        TimingWheelSchedule(&wheel, ENTITY_TOWER(towerCount),
+            GameSpeedToDelay(pgm_read_byte(&(levels[level].AttackSpeed))));
+        towerCount++;
         GameRenderStatusP(TowerBuilt);
         
         gold -= TOWER_BUILD_COST;
+        GameMarkHudDirty(Hud_Gold);
 
         return;
     }
@@ -214,31 +360,56 @@ void GameNewTower()
 /*
  * Creates a new bot
  */
-void GameNewBot(const Point_t p)
+void GameNewBot(const Cell_t cell)
 {
     if(botCount < MAX_BOTS)
     {
-        bots[botCount].HealthPoints =
-            pgm_read_byte(&(levels[level].HealthPoints));
-        bots[botCount].Position = p;
-        GameRenderBot(&bots[botCount++]);
+        uint8_t health = pgm_read_byte(&(levels[level].HealthPoints));
+
+        GameMarkDirty(cell);
+        botCells[botCount] = cell;
+        botState[botCount] = ((health < BOT_HEALTH_MAX)
+            ? health : BOT_HEALTH_MAX) << BOT_STATE_HEALTH_SHIFT;
+        
+        TimingWheelSchedule(&wheel, botCount,
+            GameSpeedToDelay(pgm_read_byte(&(levels[level].MoveSpeed))));
+        botCount++;
+        botsAlive++;
+        GameMarkHudDirty(Hud_Bots);
     }
 }
 
 /*
- * Returns a bool indicating whether there is a bot at the point provided
+ * Returns the index of the live bot in the cell provided or BOT_NONE
  */
-Bot_t *GameBotByPoint(const Point_t p)
+uint8_t GameBotByCell(const Cell_t cell)
 {
     for(uint8_t i = 0; i < botCount; i++)
     {
-        if(PointsEqual(bots[i].Position, p))
+        if(BOT_CELL(botCells[i]) == cell && BOT_HEALTH(botState[i]) > 0)
         {
-            return &bots[i];
+            return i;
         }
     }
     
-    return NULL;
+    return BOT_NONE;
+}
+
+/*
+ * Gets the number of flood attempts made by a bot since it last moved
+ */
+uint8_t GameBotFloodAttempts(const uint8_t bot)
+{
+    return botState[bot] & BOT_STATE_FLOOD_MASK;
+}
+
+/*
+ * Sets the number of flood attempts made by a bot
+ */
+void GameSetBotFloodAttempts(const uint8_t bot, const uint8_t attempts)
+{
+    botState[bot] = (botState[bot] & ~BOT_STATE_FLOOD_MASK)
+        | (attempts & BOT_STATE_FLOOD_MASK);
 }
 
 /*
@@ -246,464 +417,1695 @@ Bot_t *GameBotByPoint(const Point_t p)
  */
 void GameAttackBot(const uint8_t botIndex, const uint8_t damage)
 {
-    int16_t newHp = bots[botIndex].HealthPoints - damage;
+    uint8_t health = BOT_HEALTH(botState[botIndex]);
+    int16_t newHp = health - damage;
     newHp = newHp < 0 ? 0 : newHp;
-    bots[botIndex].HealthPoints = newHp;
+
+    if(newHp == 0 && health > 0)
+    {
+        GameMarkDirty(BOT_CELL(botCells[botIndex]));
+        botsAlive--;
+        GameMarkHudDirty(Hud_Bots);
+    }
+
+    botState[botIndex] = (botState[botIndex] & BOT_STATE_FLOOD_MASK)
+        | (newHp << BOT_STATE_HEALTH_SHIFT);
 
     if(newHp == 0)
     {
-        GameRenderTilePosition(bots[botIndex].Position);
+        GameWakeBots(BOT_CELL(botCells[botIndex]));
     }
 }
 
 /*
- * Renders the game
+ * Parks a bot until the cell in the given direction is vacated. The bot is
+ * not parked if the bots ahead of it are already waiting on it, as nothing
+ * would ever wake them.
  */
-void GameRender()
+bool GameParkBot(const uint8_t bot, const Direction_t direction)
 {
-    static Size_t prevWindowSize;
-    static int32_t prevGold;
-    static Point_t prevViewPosition;
-    static Point_t prevCursorPosition;
-
-    if(!SizesEqual(&prevWindowSize, &windowSize))
-    {
-        TerminalSetBgColor(COLOR_BORDER);
-        TerminalClearScreen();
-        GameRenderMap();
-        GameRenderBorders();
-        GameRenderCursor();
-
-        prevWindowSize = windowSize;
-        prevGold = gold;
-        prevViewPosition = viewPosition;
-        prevCursorPosition = cursorPosition;
-    }
-    else
+    Cell_t cell = CellNeighbor(BOT_CELL(botCells[bot]), direction);
+    
+    uint8_t blocker = GameBotByCell(cell);
+    for(uint8_t i = 0; blocker != BOT_NONE && i < MAX_BOTS; i++)
     {
-        if(!PointsEqual(prevViewPosition, viewPosition))
+        if(blocker == bot)
         {
-            GameRenderMap();
-            GameRenderCursor();
-            prevViewPosition = viewPosition;
+            return FALSE;
         }
-
-        if(prevGold != gold)
+        else if(!(botCells[blocker] & BOT_CELL_WAITING))
         {
-            GameRenderBorders();
-            prevGold = gold;
+            break;
         }
         
-        if(!PointsEqual(prevCursorPosition, cursorPosition))
-        {
-            GameRenderCursor();
-            prevCursorPosition = cursorPosition;
-        }
+        blocker = GameBotByCell(GameBotWaitCell(blocker));
     }
+
+    botCells[bot] = BOT_CELL(botCells[bot])
+        | ((Cell_t)direction << BOT_CELL_DIRECTION_SHIFT) | BOT_CELL_WAITING;
+    
+    uint8_t *head = &waitHeads[cell % WAIT_BUCKETS];
+    entityNext[bot] = *head;
+    *head = bot;
+    
+    return TRUE;
 }
 
 /*
- * Renders a map tile
+ * Gets the cell that a parked bot is waiting on
  */
-void GameRenderTile(const TileType_t tile)
+Cell_t GameBotWaitCell(const uint8_t bot)
 {
-    TermColor_t color = GameGetTileBgColor(tile);
-    TerminalSetBgColor(color);
-
-    color = GameGetTileFgColor(tile);
-    TerminalSetFgColor(color);
-
-    char symbol = GameGetTileCharacter(tile);
-    UartTransmitByte(symbol);
+    return CellNeighbor(BOT_CELL(botCells[bot]), (botCells[bot]
+        & BOT_CELL_DIRECTION_MASK) >> BOT_CELL_DIRECTION_SHIFT);
 }
 
 /*
- * Renders a map tile at a position
+ * Wakes the bots waiting on a cell that has just been vacated and schedules
+ * them to move on the next step
  */
-void GameRenderTilePosition(const Point_t p)
+void GameWakeBots(const Cell_t cell)
 {
-    int16_t screenX = p.X - viewPosition.X;
-    int16_t screenY = p.Y - viewPosition.Y;
+    uint8_t *link = &waitHeads[cell % WAIT_BUCKETS];
 
-    if(screenX >= 0
-        && screenX < (windowSize.Width - (2 * BORDER_WIDTH))
-        && screenY >= 0
-        && screenY < (windowSize.Height - (2 * BORDER_WIDTH)))
+    while(*link != BOT_NONE)
     {
-        screenX += BORDER_WIDTH;
-        screenY += BORDER_WIDTH;
-        TerminalCursorMoveXY(screenX, screenY);
-        
-        TileType_t tile = GameGetTile(p);
-        GameRenderTile(tile);
+        uint8_t bot = *link;
+
+        if(GameBotWaitCell(bot) == cell)
+        {
+            *link = entityNext[bot];
+            botCells[bot] = BOT_CELL(botCells[bot]);
+            TimingWheelSchedule(&wheel, bot, 1);
+        }
+        else
+        {
+            link = &entityNext[bot];
+        }
     }
 }
 
 /*
- * Renders the map tiles
+ * Renders the game. A frame with anything to draw is sent as one
+ * synchronized update, which is opened by the first piece of the frame that
+ * the link has room for.
  */
-void GameRenderMap()
+void GameRender()
 {
-    TerminalCursorHide();
-    
-    for(uint8_t y = 0; y < (windowSize.Height - (BORDER_WIDTH * 2))
-        && (viewPosition.Y + y) < MAP_HEIGHT; y++)
+    bool resized = !SizesEqual(&screenSize, &windowSize);
+
+    if(repaintScreen)
     {
-        TerminalCursorMoveXY(BORDER_WIDTH, y + BORDER_WIDTH);
-        
-        for(uint8_t x = 0; x < (windowSize.Width - (BORDER_WIDTH * 2))
-            && (viewPosition.X + x) < MAP_WIDTH; x++)
-        {
-            Point_t p = { .X = viewPosition.X + x,
-                          .Y = viewPosition.Y + y };
+        TerminalBeginUpdate();
+        TerminalSetSize(&windowSize);
+        TerminalSetBgColor(COLOR_BORDER);
+        TerminalClearScreen();
+        ShadowClear();
+        GameRenderBorders();
+
+        // The whole map will be drawn so pending cells are already covered
+        screenView = viewPosition;
+        GameClearMapJobs();
+        GameQueueMap();
+        dirtyCount = 0;
 
-            TileType_t tile = GameGetTile(p); 
-            GameRenderTile(tile);
+        repaintScreen = FALSE;
+        resizeRow = 0;
+        panShift = 0;
+        screenSize = windowSize;
+    }
+    else if(resized)
+    {
+        // Anything drawn before the rows are erased could be erased with them
+        if(!GameRenderResize(&screenSize))
+        {
+            linkBehind = TRUE;
+            TerminalEndUpdate();
+            return;
         }
+
+        GameRenderBorders();
+        screenSize = windowSize;
     }
-    
-    GameRenderBase();
-    GameRenderBots();
-    GameRenderTowers();
+
+    GameRenderHud();
+
+    if((panShift != 0 || !PointsEqual(screenView, viewPosition))
+        && !GameRenderPan())
+    {
+        linkBehind = TRUE;
+    }
+
+    // Nothing else can be placed until the map on screen matches the view
+    if(panShift == 0 && PointsEqual(screenView, viewPosition))
+    {
+        GameRenderMap();
+
+        // Costs nothing when the cursor has not moved since the last frame
+        GameRenderCursor();
+    }
+
+    TerminalEndUpdate();
 }
 
 /*
- * Renders a bot onto the map
+ * Draws the map cells waiting to be drawn between frames, so that the map
+ * is only held back by the link and not by the frame rate. Nothing is drawn
+ * until a frame has laid the screen out for the current window and view,
+ * and the cursor is put back where that frame left it.
  */
-void GameRenderBot(const Bot_t *bot)
+void GameRenderPending()
 {
-    if(bot->HealthPoints > 0)
+    if(!GameScreenSettled())
     {
-        int16_t botX = bot->Position.X - viewPosition.X;
-        int16_t botY = bot->Position.Y - viewPosition.Y;
-        
-        if(botX >= 0 && botX < (windowSize.Width - (BORDER_WIDTH * 2))
-            && botY >= 0 && botY < (windowSize.Height - (BORDER_WIDTH * 2)))
-        {
-            TerminalCursorMoveXY(botX + BORDER_WIDTH, botY + BORDER_WIDTH);
-            TerminalSetBgColor(COLOR_BOT_BG);
-            TerminalSetFgColor(COLOR_BOT_FG);
-            UartTransmitByte(BOT_CHAR);
-        }
+        return;
     }
-}
 
-void GameRenderTower(const Tower_t *tower)
-{
-    uint8_t towerX = tower->Position.X - viewPosition.X;
-    uint8_t towerY = tower->Position.Y - viewPosition.Y;
+    // Between frames the link is expected to be busy, only frames judge it
+    bool behind = linkBehind;
+    linkReserve = RENDER_PENDING_RESERVE;
+    GameRenderMap();
+    linkReserve = 0;
+    linkBehind = behind;
 
-    TerminalCursorMoveXY(towerX + BORDER_WIDTH, towerY + BORDER_WIDTH);
-    TerminalSetBgColor(COLOR_TOWER_BG);
-    TerminalSetFgColor(COLOR_TOWER_FG);
-    UartTransmitByte(tower->Level + '0');
+    TerminalCursorMoveXY(screenCursor.X, screenCursor.Y);
+    TerminalEndUpdate();
 }
 
-void GameRenderTowers()
+/*
+ * Returns TRUE when the screen is laid out for the current window and view,
+ * with no repaint, resize or pan part way through
+ */
+bool GameScreenSettled()
 {
-    for(uint8_t i = 0; i < towerCount; i++)
-    {
-        int16_t towerX = towers[i].Position.X - viewPosition.X;
-        int16_t towerY = towers[i].Position.Y - viewPosition.Y;
-
-        if(towerX >= 0
-            && towerX < windowSize.Width - (2 * BORDER_WIDTH)
-            && towerY >= 0
-            && towerY < windowSize.Height - (2 * BORDER_WIDTH))
-        {
-            GameRenderTower(&towers[i]);
-        }
-    }
+    return !repaintScreen
+        && panShift == 0
+        && SizesEqual(&screenSize, &windowSize)
+        && PointsEqual(screenView, viewPosition);
 }
 
-void GameRenderBots()
+/*
+ * Draws the changed cells and then the map jobs as far as the link allows
+ */
+void GameRenderMap()
 {
-    for(uint8_t i = 0; i < botCount; i++)
+    // Entities before terrain
+    if(renderProfile != Profile_Minimal || (profileStep & 1))
     {
-        GameRenderBot(&bots[i]);
+        GameRenderDirty();
     }
+
+    GameRenderMapJob();
 }
 
 /*
- * Renders the base
+ * Returns TRUE if the link can take the given number of bytes without
+ * waiting, leaving room to end the frame and whatever is kept back for the
+ * next one. The synchronized update of the frame is opened once the first
+ * piece fits, so its bytes are counted too and a frame where nothing fits
+ * sends nothing.
  */
-void GameRenderBase()
+bool GameLinkHasRoom(const uint8_t bytes)
 {
-    int16_t baseX = basePosition.X - viewPosition.X;
-    int16_t baseY = basePosition.Y - viewPosition.Y;
-    
-    if(baseX >= 0
-        && baseX < (windowSize.Width - (BORDER_WIDTH * 2))
-        && baseY >= 0
-        && baseY < (windowSize.Height - (BORDER_WIDTH * 2)))
+    if(UartTransmitSpace() < bytes + RENDER_END_BYTES + linkReserve
+        + TerminalBeginUpdateLength())
     {
-        TerminalCursorMoveXY(baseX + BORDER_WIDTH, baseY + BORDER_WIDTH);
-        TerminalSetBgColor(COLOR_BASE);
-        UartTransmitByte(BASE_CHAR);
+        return FALSE;
     }
+
+    TerminalBeginUpdate();
+    return TRUE;
 }
 
-void GameRenderBorders()
+/*
+ * Measures the link once per game step and changes the render profile when
+ * it has been behind or idle for long enough. The capacity of the link is
+ * what it sends in a step while behind, and its usage is averaged over
+ * steps so that a single repaint does not count against going back up.
+ * Each drop doubles the idle steps needed to step up again so that a link
+ * near the edge of a profile does not flap between the two, and a step up
+ * that holds for that long halves them again.
+ */
+void GameUpdateProfile()
 {
-    TerminalSetBgColor(COLOR_BORDER);
-    TerminalSetFgColor(TermColor_FFFFFF);
-    TerminalCursorMoveXY(0, 0);
-    TerminalInsertSpaces(windowSize.Width);
-    TerminalCursorMoveXY(BORDER_PAD, 0);
+    uint16_t sent = UartBytesSent() - linkBytesSent;
+    linkBytesSent += sent;
+    linkUsage = (linkUsage / 8) * 7 + (sent / 8);
+    profileStep++;
 
-    char buf[20];
-    sprintf(buf, "Gold %ld  ", gold);
-    UartPrint(buf, strlen(buf));
+    if(linkBehind)
+    {
+        linkCapacity = (linkCapacity == 0)
+            ? sent : (linkCapacity / 4) * 3 + (sent / 4);
+        linkIdleSteps = 0;
 
-    sprintf(buf, "Level %u  ", level + 1);
-    UartPrint(buf, strlen(buf));
-    
-}
+        if(++linkBehindSteps >= PROFILE_DOWN_STEPS
+            && renderProfile != Profile_Minimal)
+        {
+            GameSetProfile(renderProfile + 1);
+            linkBehindSteps = 0;
 
-void GameRenderCursor()
-{
-    int16_t cursorX = cursorPosition.X - viewPosition.X;
-    int16_t cursorY = cursorPosition.Y - viewPosition.Y;
+            if(profileUpSteps < PROFILE_UP_STEPS_MAX)
+            {
+                profileUpSteps *= 2;
+            }
 
-    if(cursorX < 0)
-    {
-        cursorX = 0;
-    }
-    else if(cursorX >=
-        (viewPosition.X + windowSize.Width - (2 * BORDER_WIDTH)))
-    {
-        cursorX = windowSize.Width - 1;
+            profileRaised = FALSE;
+        }
     }
     else
     {
-        cursorX += BORDER_WIDTH;
-    }
+        linkBehindSteps = 0;
 
-    if(cursorY < 0)
-    {
-        cursorY = 0;
+        // Sending this much without falling behind shows the link can
+        linkCapacity = (sent > linkCapacity) ? sent : linkCapacity;
+
+        if(linkUsage < linkCapacity / 2)
+        {
+            if(++linkIdleSteps >= profileUpSteps
+                && renderProfile != Profile_Full)
+            {
+                GameSetProfile(renderProfile - 1);
+                linkIdleSteps = 0;
+                profileHeldSteps = 0;
+                profileRaised = TRUE;
+            }
+        }
+        else
+        {
+            linkIdleSteps = 0;
+        }
     }
-    else if(cursorY >=
-        (viewPosition.Y + windowSize.Height - (2 * BORDER_WIDTH)))
+
+    if(profileRaised && ++profileHeldSteps >= profileUpSteps)
     {
-        cursorY = windowSize.Height - 1;
+        profileHeldSteps = 0;
+
+        if(profileUpSteps > PROFILE_UP_STEPS)
+        {
+            profileUpSteps /= 2;
+        }
     }
-    else
+
+    linkBehind = FALSE;
+}
+
+/*
+ * Changes the render profile. Cells already drawn with less detail are only
+ * redrawn when stepping up. They are queued as map jobs, which the link
+ * budget spreads over frames, rather than repainting the screen at once.
+ * The border keeps the colors it was drawn with until the next repaint.
+ */
+void GameSetProfile(const RenderProfile_t profile)
+{
+    if(profile < renderProfile)
     {
-        cursorY += BORDER_WIDTH;
+        ShadowClear();
+        GameQueueMap();
     }
-    
-    TerminalCursorMoveXY(cursorX, cursorY);
-    TerminalCursorShow();
+
+    TerminalUseBasicColors(profile != Profile_Full);
+    renderProfile = profile;
 }
 
-void GameClearStatus()
+/*
+ * Records that a map cell will change, along with the shadow id of what it
+ * shows now. Cells are drawn when the set is flushed at the next frame, or
+ * early when the set is full. The caller marks cells before changing them.
+ */
+void GameMarkDirty(const Cell_t cell)
 {
-    TerminalSetBgColor(COLOR_BORDER);
-    TerminalSetFgColor(TermColor_FFFFFF);
-    TerminalCursorMoveXY(0, windowSize.Height - 1);
-    TerminalInsertSpaces(windowSize.Width);
+    GameReserveDirty(1);
+    GameAddDirty(cell);
 }
 
 /*
- * Renders a status message onto the bottom of the window
+ * Marks both cells of a move. Both are marked before the move so that an
+ * early flush can not separate them.
  */
-void GameRenderStatusP(const char *status)
+void GameMarkMoveDirty(const Cell_t from, const Cell_t to)
 {
-    GameClearStatus();
+    GameReserveDirty(2);
+    GameAddDirty(from);
+    GameAddDirty(to);
+}
 
-    uint8_t length = strlen_P(status);
-    if(length > (windowSize.Width - (BORDER_PAD * 2)))
+/*
+ * Makes room in the dirty set. It is flushed as far as the link allows and
+ * whatever is left is handed over to the spill jobs.
+ */
+void GameReserveDirty(const uint8_t count)
+{
+    // A flush between frames is an update of its own. Rows part way through
+    // a shift or resize do not match the view, so their cells wait in the
+    // spill jobs.
+    if(dirtyCount + count > DIRTY_CELLS && GameScreenSettled())
     {
-        length = windowSize.Width - (BORDER_PAD * 2);
+        GameRenderDirty();
+        TerminalEndUpdate();
     }
-    
-    TerminalCursorMoveXY(BORDER_PAD, windowSize.Height - 1);
-    UartPrintP(status, length);
-}
 
-void GameRenderStatus(const char *status)
-{
-    GameClearStatus();
-    
-    uint8_t length = strlen(status);
-    if(length > (windowSize.Width - (BORDER_PAD * 2)))
+    if(dirtyCount + count > DIRTY_CELLS)
     {
-        length = windowSize.Width - (BORDER_PAD * 2);
+        GameQueueDirty();
     }
-    
-    TerminalCursorMoveXY(BORDER_PAD, windowSize.Height - 1);
-    UartPrint(status, length);
 }
 
 /*
- * Parses user input
+ * Adds a cell to the dirty set if it is not already there. The first
+ * appearance recorded for a cell is kept.
  */
-void GameParseInput()
+void GameAddDirty(const Cell_t cell)
 {
-    static uint8_t csCount = 0;
-    static char params[PARAM_COUNT][PARAM_BUF_LEN] = {{ 0 }};
-    
-    while(UartBytesToReceive())
+    for(uint8_t i = 0; i < dirtyCount; i++)
     {
-        uint8_t b = UartReceiveByte();
-        
-        // CCI Begin (ESC)
-        if(b == 0x1B && csCount == 0)
+        if(dirtyCells[i] == cell)
         {
-            csCount++;
-        }
-        // CCI Begin ([)
-        else if(b == 0x5B && csCount == 1)
-        {
-            csCount++;
+            return;
         }
-        // Down Arrow
-        else if(b == 0x42 && csCount == 2)
+    }
+
+    dirtyCells[dirtyCount] = cell;
+    dirtyIds[dirtyCount++] = GameGlyphShadowId(GameCellGlyphAt(cell));
+}
+
+/*
+ * Draws the cells in the dirty set. Cells that are back to the appearance
+ * they had when marked are dropped. The rest are sorted by row and then by
+ * style so that cursor moves and color changes are short. Cells the link has
+ * no room for stay in the set.
+ */
+void GameRenderDirty()
+{
+    uint16_t mark = ArenaMark();
+    DirtyEntry_t *entries = ArenaAlloc(dirtyCount * sizeof(DirtyEntry_t));
+    uint8_t count = 0;
+
+    for(uint8_t i = 0; i < dirtyCount && entries != NULL; i++)
+    {
+        Glyph_t glyph = GameCellGlyphAt(dirtyCells[i]);
+        uint8_t id = GameGlyphShadowId(glyph);
+
+        if(id != SHADOW_UNKNOWN && id == dirtyIds[i])
+        {
+            continue;
+        }
+
+        Point_t p = CellToPoint(dirtyCells[i]);
+        DirtyEntry_t entry = {
+            .Key = DIRTY_KEY(p.Y, GLYPH_STYLE(glyph), p.X),
+            .Glyph = glyph,
+            .Id = dirtyIds[i]
+        };
+
+        // Insertion sort, the set is small
+        uint8_t j = count++;
+        for(; j > 0 && entries[j - 1].Key > entry.Key; j--)
+        {
+            entries[j] = entries[j - 1];
+        }
+
+        entries[j] = entry;
+    }
+
+    if(entries == NULL)
+    {
+        ArenaRelease(mark);
+        return;
+    }
+
+    dirtyCount = 0;
+
+    for(uint8_t i = 0; i < count; i++)
+    {
+        Point_t p = {
+            .X = DIRTY_KEY_X(entries[i].Key),
+            .Y = DIRTY_KEY_Y(entries[i].Key)
+        };
+
+        if(GameLinkHasRoom(RENDER_RUN_BYTES))
+        {
+            GameRenderGlyph(p, entries[i].Glyph);
+        }
+        else
+        {
+            dirtyCells[dirtyCount] = CELL_XY(p.X, p.Y);
+            dirtyIds[dirtyCount++] = entries[i].Id;
+            linkBehind = TRUE;
+        }
+    }
+
+    ArenaRelease(mark);
+}
+
+/*
+ * Empties the dirty set into the spill jobs
+ */
+void GameQueueDirty()
+{
+    for(uint8_t i = 0; i < dirtyCount; i++)
+    {
+        GameQueueSpill(dirtyCells[i]);
+    }
+
+    dirtyCount = 0;
+}
+
+/*
+ * Renders a run of identical glyphs. Empty tiles are blanked in whichever
+ * way is shorter.
+ */
+void GameRenderGlyphRun(const Glyph_t glyph, const uint8_t count)
+{
+    if(count == 0)
+    {
+        return;
+    }
+
+    uint8_t style = GLYPH_STYLE(glyph);
+
+    // Blank cells only show their background
+    if(style == Tile_Empty || GLYPH_CHAR(glyph) == ' ')
+    {
+        TerminalSetBgColor(pgm_read_byte(&(glyphStyles[style].Bg)));
+    }
+    else
+    {
+        TerminalSetStyleP(&glyphStyles[style]);
+    }
+
+    if(style == Tile_Empty)
+    {
+        TerminalBlankChars(count);
+    }
+    else
+    {
+        TerminalRepeatChar(GLYPH_CHAR(glyph), count);
+    }
+}
+
+/*
+ * Renders a glyph at a map position if it is on screen and differs from what
+ * the terminal shows
+ */
+void GameRenderGlyph(const Point_t p, const Glyph_t glyph)
+{
+    int16_t screenX = p.X - screenView.X;
+    int16_t screenY = p.Y - screenView.Y;
+
+    if(screenX >= 0
+        && screenX < (windowSize.Width - (2 * BORDER_WIDTH))
+        && screenY >= 0
+        && screenY < (windowSize.Height - (2 * BORDER_WIDTH))
+        && GameShadowUpdate(screenX, screenY, glyph))
+    {
+        TerminalCursorMoveXY(screenX + BORDER_WIDTH, screenY + BORDER_WIDTH);
+        GameRenderGlyphRun(glyph, 1);
+    }
+}
+
+/*
+ * Records a glyph in the shadow of a view cell. Returns FALSE if the cell
+ * already shows the glyph and does not need to be sent.
+ */
+bool GameShadowUpdate(const uint8_t x, const uint8_t y, const Glyph_t glyph)
+{
+    uint8_t id = GameGlyphShadowId(glyph);
+
+    if(id != SHADOW_UNKNOWN && ShadowGet(x, y) == id)
+    {
+        return FALSE;
+    }
+
+    ShadowSet(x, y, id);
+    return TRUE;
+}
+
+/*
+ * Returns the shadow id of a glyph. Towers with a level too high for the
+ * id space are unknown so they are always sent.
+ */
+uint8_t GameGlyphShadowId(const Glyph_t glyph)
+{
+    uint8_t style = GLYPH_STYLE(glyph);
+
+    if(style < STYLE_TOWER)
+    {
+        return style + 1;
+    }
+
+    uint8_t id = STYLE_TOWER + 1 + (GLYPH_CHAR(glyph) - '0');
+    return (id < SHADOW_IDS) ? id : SHADOW_UNKNOWN;
+}
+
+/*
+ * Adapts the screen to a new window size. Terminals keep what still fits of
+ * the old screen at the top left and blank the rest, so only the border
+ * where it moved is erased to its color and the map cells that come into
+ * view are queued. The top row is left to GameRenderBorders. Rows are erased
+ * while the link has room and the rest are left for later frames, so this
+ * returns TRUE once the last of them is done.
+ */
+bool GameRenderResize(const Size_t *prevSize)
+{
+    uint8_t width = windowSize.Width;
+    uint8_t height = windowSize.Height;
+
+    // The rows of a shift under way no longer line up with the new size
+    if(panShift != 0)
+    {
+        repaintScreen = TRUE;
+        return FALSE;
+    }
+
+    if(resizeRow == 0)
+    {
+        TerminalSetSize(&windowSize);
+        resizeSize = windowSize;
+        resizeRow = 1;
+    }
+    else if(!SizesEqual(&resizeSize, &windowSize))
+    {
+        // Not worth working out what the size in between left behind
+        resizeRow = 0;
+        repaintScreen = TRUE;
+        return FALSE;
+    }
+
+    for(; resizeRow < height; resizeRow++)
+    {
+        uint8_t y = resizeRow;
+        uint8_t x = width;
+
+        if(y >= prevSize->Height || y == height - 1)
+        {
+            x = 0;
+        }
+        else if(width > prevSize->Width)
+        {
+            x = prevSize->Width;
+        }
+        else if(width < prevSize->Width)
+        {
+            x = width - 1;
+        }
+
+        if(x < width)
+        {
+            if(!GameLinkHasRoom(RENDER_ERASE_BYTES))
+            {
+                return FALSE;
+            }
+
+            TerminalCursorHide();
+            TerminalSetBgColor(COLOR_BORDER);
+            TerminalCursorMoveXY(x, y);
+            TerminalEraseLine();
+        }
+    }
+
+    resizeRow = 0;
+
+    uint8_t viewWidth = width - (BORDER_WIDTH * 2);
+    uint8_t viewHeight = height - (BORDER_WIDTH * 2);
+    uint8_t prevWidth = prevSize->Width - (BORDER_WIDTH * 2);
+    uint8_t prevHeight = prevSize->Height - (BORDER_WIDTH * 2);
+
+    ShadowClip((viewWidth < prevWidth) ? viewWidth : prevWidth,
+        (viewHeight < prevHeight) ? viewHeight : prevHeight);
+
+    if(viewWidth > prevWidth)
+    {
+        GameQueueViewRect(prevWidth, 0, viewWidth - prevWidth, viewHeight);
+    }
+
+    if(viewHeight > prevHeight)
+    {
+        GameQueueViewRect(0, prevHeight, viewWidth, viewHeight - prevHeight);
+    }
+
+    return TRUE;
+}
+
+/*
+ * Queues the map tiles in view
+ */
+void GameQueueMap()
+{
+    GameQueueViewRect(0, 0, windowSize.Width - (BORDER_WIDTH * 2),
+        windowSize.Height - (BORDER_WIDTH * 2));
+}
+
+/*
+ * Queues a rectangle of the view on screen, clipped to the map
+ */
+void GameQueueViewRect(const uint8_t left, const uint8_t top,
+    const uint8_t width, const uint8_t height)
+{
+    uint16_t right = screenView.X + left + width;
+    uint16_t bottom = screenView.Y + top + height;
+
+    GameQueueMapRect(screenView.X + left, screenView.Y + top,
+        (right < MAP_WIDTH) ? right : MAP_WIDTH,
+        (bottom < MAP_HEIGHT) ? bottom : MAP_HEIGHT);
+}
+
+/*
+ * Adds a rectangle of map cells to the map job
+ */
+void GameQueueMapRect(const uint8_t left, const uint8_t top,
+    const uint8_t right, const uint8_t bottom)
+{
+    GameJobAddRect(&mapJob, left, top, right, bottom);
+}
+
+/*
+ * Adds a rectangle of map cells to a job. A job already in progress grows
+ * to cover both and only goes back when the rectangle reaches into the
+ * part it has already drawn.
+ */
+void GameJobAddRect(MapJob_t *job, const uint8_t left, const uint8_t top,
+    const uint8_t right, const uint8_t bottom)
+{
+    if(left >= right || top >= bottom)
+    {
+        return;
+    }
+
+    if(!job->Active)
+    {
+        job->Active = TRUE;
+        job->Left = left;
+        job->Top = top;
+        job->Right = right;
+        job->Bottom = bottom;
+        job->X = left;
+        job->Y = top;
+        return;
+    }
+
+    job->Left = (left < job->Left) ? left : job->Left;
+    job->Top = (top < job->Top) ? top : job->Top;
+    job->Right = (right > job->Right) ? right : job->Right;
+    job->Bottom = (bottom > job->Bottom) ? bottom : job->Bottom;
+
+    if(top < job->Y || (top == job->Y && left < job->X))
+    {
+        job->X = job->Left;
+        job->Y = top;
+    }
+}
+
+/*
+ * Queues a cell spilled from the dirty set. It joins the spill job that
+ * grows the least to cover it, or starts a free one when that would grow by
+ * more than SPILL_MERGE_CELLS.
+ */
+void GameQueueSpill(const Cell_t cell)
+{
+    Point_t p = CellToPoint(cell);
+    MapJob_t *best = NULL;
+    MapJob_t *unused = NULL;
+    uint16_t bestGrowth = 0xFFFF;
+
+    for(uint8_t i = 0; i < SPILL_JOBS; i++)
+    {
+        MapJob_t *job = &spillJobs[i];
+
+        if(!job->Active)
+        {
+            unused = (unused == NULL) ? job : unused;
+            continue;
+        }
+
+        uint8_t left = (p.X < job->Left) ? p.X : job->Left;
+        uint8_t top = (p.Y < job->Top) ? p.Y : job->Top;
+        uint8_t right = (p.X >= job->Right) ? p.X + 1 : job->Right;
+        uint8_t bottom = (p.Y >= job->Bottom) ? p.Y + 1 : job->Bottom;
+        uint16_t growth = ((right - left) * (bottom - top))
+            - ((job->Right - job->Left) * (job->Bottom - job->Top));
+
+        if(growth < bestGrowth)
+        {
+            best = job;
+            bestGrowth = growth;
+        }
+    }
+
+    if(unused != NULL && bestGrowth > SPILL_MERGE_CELLS)
+    {
+        best = unused;
+    }
+
+    GameJobAddRect(best, p.X, p.Y, p.X + 1, p.Y + 1);
+}
+
+/*
+ * Returns TRUE if any map cells are waiting to be drawn
+ */
+bool GameMapJobsActive()
+{
+    for(uint8_t i = 0; i < SPILL_JOBS; i++)
+    {
+        if(spillJobs[i].Active)
+        {
+            return TRUE;
+        }
+    }
+
+    return mapJob.Active;
+}
+
+/*
+ * Drops every job, for when the whole view is drawn again
+ */
+void GameClearMapJobs()
+{
+    for(uint8_t i = 0; i < SPILL_JOBS; i++)
+    {
+        spillJobs[i].Active = FALSE;
+    }
+
+    mapJob.Active = FALSE;
+}
+
+/*
+ * Draws the spilled cells and then the map job as far as the link allows
+ */
+void GameRenderMapJob()
+{
+    for(uint8_t i = 0; i < SPILL_JOBS; i++)
+    {
+        if(!GameRenderJob(&spillJobs[i]))
+        {
+            return;
+        }
+    }
+
+    GameRenderJob(&mapJob);
+}
+
+/*
+ * Draws a job and everything on it as far as the link allows. Each row is
+ * composited in a single pass so every cell is sent once, and is sent as
+ * runs of identical glyphs. Cells out of view are dropped, a pan queues them
+ * when they come into view. Returns FALSE if the job had to stop for the
+ * link.
+ */
+bool GameRenderJob(MapJob_t *job)
+{
+    if(!job->Active)
+    {
+        return TRUE;
+    }
+
+    uint16_t viewRight = screenView.X + windowSize.Width - (BORDER_WIDTH * 2);
+    uint16_t viewBottom = screenView.Y + windowSize.Height
+        - (BORDER_WIDTH * 2);
+    uint8_t left = (job->Left > screenView.X) ? job->Left : screenView.X;
+    uint8_t right = (job->Right < viewRight) ? job->Right : viewRight;
+
+    if(left >= right)
+    {
+        job->Active = FALSE;
+        return TRUE;
+    }
+
+    uint16_t mark = ArenaMark();
+    uint8_t *layers = ArenaAlloc(right - left);
+
+    if(layers == NULL)
+    {
+        return FALSE;
+    }
+
+    // Without REP a run costs a byte per cell
+    uint8_t runLimit = TerminalHasCaps(TERM_CAP_REPEAT)
+        ? MAP_WIDTH : RENDER_RUN_CELLS;
+
+    for(; job->Y < job->Bottom; job->Y++, job->X = job->Left)
+    {
+        if(job->Y < screenView.Y || job->Y >= viewBottom)
+        {
+            continue;
+        }
+
+        uint8_t x = (job->X > left) ? job->X : left;
+        uint8_t screenY = job->Y - screenView.Y;
+        Cell_t cell = CELL_XY(x, job->Y);
+        GameFillLayers(layers, CELL_XY(left, job->Y), right - left);
+
+        Glyph_t runGlyph = 0;
+        uint8_t runLength = 0;
+
+        for(; x < right; x++)
+        {
+#ifdef MAP_CHUNKS
+            uint8_t chunkWidth = GameMapChunkWidth(x, job->Y, right,
+                &layers[x - left]);
+
+            if(chunkWidth > 0)
+            {
+                GameRenderGlyphRun(runGlyph, runLength);
+                runLength = 0;
+
+                // The rest of a chunk cut short is drawn run by run
+                uint8_t width = GameRenderMapChunk(x, job->Y);
+                if(width < chunkWidth)
+                {
+                    job->X = x + width;
+                    ArenaRelease(mark);
+                    return FALSE;
+                }
+
+                x += width - 1;
+                cell += width;
+                continue;
+            }
+#endif
+
+            Glyph_t glyph = GameCellGlyph(cell++, layers[x - left]);
+
+            if(runLength > 0
+                && (glyph != runGlyph || runLength == runLimit))
+            {
+                GameRenderGlyphRun(runGlyph, runLength);
+                runLength = 0;
+            }
+
+            // Only start a run the link can take without waiting
+            if(runLength == 0 && !GameLinkHasRoom(RENDER_RUN_BYTES))
+            {
+                job->X = x;
+                ArenaRelease(mark);
+                return FALSE;
+            }
+
+            // Cells the terminal already shows end the run and are skipped
+            if(!GameShadowUpdate(x - screenView.X, screenY, glyph))
+            {
+                GameRenderGlyphRun(runGlyph, runLength);
+                runLength = 0;
+                continue;
+            }
+
+            if(runLength == 0)
+            {
+                TerminalCursorHide();
+                TerminalCursorMoveXY(x - screenView.X + BORDER_WIDTH,
+                    screenY + BORDER_WIDTH);
+            }
+
+            runGlyph = glyph;
+            runLength++;
+        }
+
+        GameRenderGlyphRun(runGlyph, runLength);
+    }
+
+    job->Active = FALSE;
+    ArenaRelease(mark);
+    return TRUE;
+}
+
+#ifdef MAP_CHUNKS
+/*
+ * Returns the number of columns in the chunk of a map row that starts at a
+ * column, or 0 if the cells are to be drawn run by run. A chunk is only used
+ * when it is all bare terrain inside the columns to draw and none of it is
+ * known to be on screen already.
+ */
+uint8_t GameMapChunkWidth(const uint8_t x, const uint8_t y,
+    const uint8_t right, const uint8_t *layers)
+{
+    uint8_t width = (MAP_WIDTH - x < MAP_CHUNK_WIDTH)
+        ? MAP_WIDTH - x : MAP_CHUNK_WIDTH;
+
+    if(x % MAP_CHUNK_WIDTH != 0
+        || x + width > right
+        || renderProfile != Profile_Full)
+    {
+        return 0;
+    }
+
+    for(uint8_t i = 0; i < width; i++)
+    {
+        if(layers[i] != Layer_Terrain)
+        {
+            return 0;
+        }
+    }
+
+#ifdef SHADOW_ROWS
+    // Compared a run at a time, so the shadow costs no tile decoding
+    uint8_t screenX = x - screenView.X;
+    uint8_t screenY = y - screenView.Y;
+
+    if(screenY < SHADOW_ROWS)
+    {
+        uint16_t index = (y * MAP_ROW_CHUNKS) + (x / MAP_CHUNK_WIDTH);
+        uint16_t end = pgm_read_word(&(mapChunkOffsets[index + 1]));
+
+        for(uint16_t i = pgm_read_word(&(mapChunkOffsets[index]));
+            i < end; i++)
+        {
+            uint8_t run = pgm_read_byte(&(mapChunkRuns[i]));
+            TileType_t tile = MAP_RUN_TILE(run);
+            uint8_t id = GameGlyphShadowId(GLYPH(tile,
+                GameGetTileCharacter(tile)));
+
+            for(uint8_t k = MAP_RUN_LENGTH(run); k > 0; k--)
+            {
+                if(ShadowGet(screenX++, screenY) == id)
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+#endif
+
+    return width;
+}
+
+/*
+ * Draws the runs of tiles that MapTools encoded for the chunk of a map row
+ * starting at a column, without decoding the tiles one by one. Stops when
+ * the link is out of room and returns the number of columns drawn.
+ */
+uint8_t GameRenderMapChunk(const uint8_t x, const uint8_t y)
+{
+    uint16_t index = (y * MAP_ROW_CHUNKS) + (x / MAP_CHUNK_WIDTH);
+    uint16_t end = pgm_read_word(&(mapChunkOffsets[index + 1]));
+    uint8_t screenX = x - screenView.X;
+    uint8_t screenY = y - screenView.Y;
+    uint8_t width = 0;
+
+    for(uint16_t i = pgm_read_word(&(mapChunkOffsets[index])); i < end; i++)
+    {
+        if(!GameLinkHasRoom(RENDER_RUN_BYTES))
+        {
+            break;
+        }
+
+        uint8_t run = pgm_read_byte(&(mapChunkRuns[i]));
+        TileType_t tile = MAP_RUN_TILE(run);
+        uint8_t length = MAP_RUN_LENGTH(run);
+        Glyph_t glyph = GLYPH(tile, GameGetTileCharacter(tile));
+
+        for(uint8_t k = 0; k < length; k++)
+        {
+            ShadowSet(screenX + width + k, screenY, GameGlyphShadowId(glyph));
+        }
+
+        TerminalCursorMoveXY(screenX + width + BORDER_WIDTH,
+            screenY + BORDER_WIDTH);
+        GameRenderGlyphRun(glyph, length);
+        width += length;
+    }
+
+    return width;
+}
+#endif
+
+/*
+ * Finds the top layer of each cell in a run of cells along a row. The low
+ * bits of each entry hold the Layer_t and towers keep their level above it.
+ */
+void GameFillLayers(uint8_t *layers, const Cell_t cell, const uint8_t count)
+{
+    memset(layers, Layer_Terrain, count);
+
+    // Offsets are unsigned so cells before the run are out of range too
+    uint16_t x = baseCell - cell;
+    if(x < count)
+    {
+        layers[x] = Layer_Base;
+    }
+
+    for(uint8_t i = 0; i < botCount; i++)
+    {
+        x = BOT_CELL(botCells[i]) - cell;
+
+        if(x < count && BOT_HEALTH(botState[i]) > 0
+            && (layers[x] & LAYER_MASK) < Layer_Bot)
         {
-            if(viewPosition.Y <
-                    (MAP_HEIGHT - windowSize.Height + (BORDER_WIDTH * 2))
-                && windowSize.Height < MAP_HEIGHT)
-            {
-                viewPosition.Y++;
-            }
+            layers[x] = Layer_Bot;
+        }
+    }
+
+    for(uint8_t i = 0; i < towerCount; i++)
+    {
+        x = towers[i].Cell - cell;
+
+        if(x < count)
+        {
+            layers[x] = Layer_Tower | (towers[i].Level << LAYER_LEVEL_SHIFT);
+        }
+    }
+}
+
+/*
+ * Returns the glyph to draw for a cell given everything on it
+ */
+Glyph_t GameCellGlyphAt(const Cell_t cell)
+{
+    uint8_t layer;
+    GameFillLayers(&layer, cell, 1);
+    return GameCellGlyph(cell, layer);
+}
+
+/*
+ * Returns the glyph to draw for a cell given its top layer
+ */
+Glyph_t GameCellGlyph(const Cell_t cell, const uint8_t layer)
+{
+    switch(layer & LAYER_MASK)
+    {
+        case Layer_Base:
+            return GLYPH(STYLE_BASE, BASE_CHAR);
+        case Layer_Bot:
+            return GLYPH(STYLE_BOT, BOT_CHAR);
+        case Layer_Tower:
+            return GLYPH(STYLE_TOWER, (layer >> LAYER_LEVEL_SHIFT) + '0');
+        default:
+        {
+            TileType_t tile = GameGetTile(cell);
+            return GLYPH(tile, (renderProfile == Profile_Full)
+                ? GameGetTileCharacter(tile) : ' ');
+        }
+    }
+}
+
+/*
+ * Moves the map on screen from the view position it was drawn for to the
+ * current one.
+ * The visible part of the map is scrolled by the terminal and only the rows
+ * or columns that come into view are queued. Moves in both directions,
+ * further than the view or that the terminal can not scroll fall back to
+ * queueing the whole map. Returns FALSE
+ * if the link has no room to scroll yet.
+ */
+bool GameRenderPan()
+{
+    // Rows part way through a shift are finished before anything else moves
+    if(panShift != 0)
+    {
+        return GameRenderPanRows();
+    }
+
+    int16_t dx = viewPosition.X - screenView.X;
+    int16_t dy = viewPosition.Y - screenView.Y;
+    uint8_t viewWidth = windowSize.Width - (BORDER_WIDTH * 2);
+    uint8_t viewHeight = windowSize.Height - (BORDER_WIDTH * 2);
+
+    if((dx != 0 && dy != 0)
+        || (dy != 0 && !TerminalHasCaps(TERM_CAP_SCROLL))
+        || GameAbs(dx) >= viewWidth
+        || GameAbs(dy) >= viewHeight)
+    {
+        screenView = viewPosition;
+        GameQueueMap();
+        return TRUE;
+    }
+
+    // Without margins each row is shifted on its own
+    if(dx != 0 && !TerminalHasCaps(TERM_CAP_MARGINS))
+    {
+        panShift = dx;
+        panRow = 0;
+        return GameRenderPanRows();
+    }
+
+    if(!GameLinkHasRoom(RENDER_PAN_BYTES))
+    {
+        return FALSE;
+    }
+
+    screenView = viewPosition;
+
+    TerminalCursorHide();
+
+    // Blank space scrolled in takes the border color until it is rendered
+    TerminalSetBgColor(COLOR_BORDER);
+
+    if(dy != 0)
+    {
+        TerminalSetScrollRegion(BORDER_WIDTH, BORDER_WIDTH + viewHeight - 1);
+
+        if(dy > 0)
+        {
+            TerminalScrollUp(dy);
+        }
+        else
+        {
+            TerminalScrollDown(-dy);
+        }
+
+        TerminalResetScrollRegion();
+        ShadowScroll(0, dy, viewWidth, viewHeight);
+        GameQueueViewRect(0, (dy > 0) ? viewHeight - dy : 0, viewWidth,
+            GameAbs(dy));
+    }
+    else
+    {
+        TerminalEnableMargins(TRUE);
+        TerminalSetScrollRegion(BORDER_WIDTH, BORDER_WIDTH + viewHeight - 1);
+        TerminalSetMargins(BORDER_WIDTH, BORDER_WIDTH + viewWidth - 1);
+        TerminalCursorMoveXY(BORDER_WIDTH, BORDER_WIDTH);
+
+        if(dx > 0)
+        {
+            TerminalDeleteColumns(dx);
+        }
+        else
+        {
+            TerminalInsertColumns(-dx);
+        }
+
+        TerminalEnableMargins(FALSE);
+        TerminalResetScrollRegion();
+        ShadowScroll(dx, 0, viewWidth, viewHeight);
+        GameQueueViewRect((dx > 0) ? viewWidth - dx : 0, 0, GameAbs(dx),
+            viewHeight);
+    }
+
+    return TRUE;
+}
+
+/*
+ * Shifts the rows of the view by panShift columns, one at a time while the
+ * link has room. Inserting pushes map tiles into the right border, so it is
+ * redrawn. Once the last row is shifted the map on screen is drawn for the
+ * new view position and the columns that came into view are queued. Returns
+ * FALSE if rows are left for a later frame.
+ */
+bool GameRenderPanRows()
+{
+    uint8_t viewWidth = windowSize.Width - (BORDER_WIDTH * 2);
+    uint8_t viewHeight = windowSize.Height - (BORDER_WIDTH * 2);
+
+    for(; panRow < viewHeight && (screenView.Y + panRow) < MAP_HEIGHT;
+        panRow++)
+    {
+        if(!GameLinkHasRoom(RENDER_SHIFT_BYTES))
+        {
+            return FALSE;
+        }
+
+        TerminalCursorHide();
+        TerminalSetBgColor(COLOR_BORDER);
+        TerminalCursorMoveXY(BORDER_WIDTH, panRow + BORDER_WIDTH);
 
-            csCount = 0;
+        if(panShift > 0)
+        {
+            TerminalDeleteChars(panShift);
+        }
+        else
+        {
+            TerminalInsertSpaces(-panShift);
+            TerminalCursorMoveXY(windowSize.Width - 1, panRow + BORDER_WIDTH);
+            TerminalPutChar(' ');
         }
-        // Up Arrow
-        else if(b == 0x41 && csCount == 2)
+    }
+
+    screenView.X += panShift;
+    ShadowScroll(panShift, 0, viewWidth, viewHeight);
+    GameQueueViewRect((panShift > 0) ? viewWidth - panShift : 0, 0,
+        GameAbs(panShift), viewHeight);
+    panShift = 0;
+
+    return TRUE;
+}
+
+/*
+ * Clears the top border and draws the labels of the fields that fit. Their
+ * values are left blank and drawn by GameRenderHud.
+ */
+void GameRenderBorders()
+{
+    TerminalSetColors(TermColor_FFFFFF, COLOR_BORDER);
+    TerminalCursorMoveXY(0, 0);
+    TerminalInsertSpaces(windowSize.Width);
+
+    uint8_t column = BORDER_PAD;
+    for(uint8_t i = 0; i < Hud_FieldCount; i++)
+    {
+        uint8_t labelLength = pgm_read_byte(&hudFields[i].LabelLength);
+        uint8_t width = pgm_read_byte(&hudFields[i].Width);
+
+        if(column + labelLength + width > windowSize.Width - BORDER_PAD)
         {
-            // Move map up
-            viewPosition.Y = (viewPosition.Y == 0) ? 0 : viewPosition.Y - 1;
-            csCount = 0;
+            break;
         }
-        // Left Arrow
-        else if(b == 0x44 && csCount == 2)
+
+        TerminalCursorMoveXY(column, 0);
+        TerminalPrintP((const char *)pgm_read_ptr(&hudFields[i].Label),
+            labelLength);
+
+        memset(hudText[i], ' ', HUD_FIELD_WIDTH);
+        column += labelLength + width + HUD_GAP;
+    }
+
+    hudDirty = (1 << Hud_FieldCount) - 1;
+}
+
+/*
+ * Marks a field of the top border to be drawn again
+ */
+void GameMarkHudDirty(const HudFieldId_t field)
+{
+    hudDirty |= 1 << field;
+}
+
+/*
+ * Returns the number shown in a field of the top border
+ */
+uint32_t GameHudValue(const HudFieldId_t field)
+{
+    switch(field)
+    {
+        case Hud_Gold:
+            return (gold < 0) ? 0 : gold;
+        case Hud_Level:
+            return level + 1;
+        case Hud_Bots:
+            return botsAlive;
+#ifdef HUD_PERF
+        case Hud_Scratch:
+            return ArenaHighWater();
+#endif
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Draws the dirty fields of the top border. Each value is left aligned in
+ * its field and only the span of characters that changed is sent. Fields
+ * that do not fit in the window are skipped and fields that do not fit in
+ * the transmit buffer stay dirty.
+ */
+void GameRenderHud()
+{
+    uint8_t column = BORDER_PAD;
+    for(uint8_t i = 0; i < Hud_FieldCount && hudDirty; i++)
+    {
+        uint8_t labelLength = pgm_read_byte(&hudFields[i].LabelLength);
+        uint8_t width = pgm_read_byte(&hudFields[i].Width);
+
+        if(column + labelLength + width > windowSize.Width - BORDER_PAD)
         {
-            viewPosition.X = (viewPosition.X == 0) ? 0 : viewPosition.X - 1;
-            csCount = 0;
+            hudDirty = 0;
+            break;
         }
-        // Right Arrow
-        else if(b == 0x43 && csCount == 2)
+
+        if(hudDirty & (1 << i))
         {
-            if(viewPosition.X <
-                    (MAP_WIDTH - windowSize.Width + (BORDER_WIDTH * 2))
-                && windowSize.Width < MAP_WIDTH)
+            if(!GameLinkHasRoom(RENDER_HUD_BYTES))
+            {
+                linkBehind = TRUE;
+                return;
+            }
+
+            char digits[HUD_FIELD_WIDTH];
+            char text[HUD_FIELD_WIDTH];
+            uint32_t value = GameHudValue(i);
+            uint8_t count = 0;
+
+            do
+            {
+                digits[count++] = '0' + (value % 10);
+                value /= 10;
+            } while(value > 0 && count < width);
+
+            // Values too wide for the field are shown as its largest
+            if(value > 0)
+            {
+                memset(digits, '9', count);
+            }
+
+            memset(text, ' ', width);
+            for(uint8_t k = 0; k < count; k++)
+            {
+                text[k] = digits[count - 1 - k];
+            }
+
+            uint8_t first = 0;
+            while(first < width && text[first] == hudText[i][first])
+            {
+                first++;
+            }
+
+            if(first < width)
             {
-                viewPosition.X++;
+                uint8_t last = width - 1;
+                while(text[last] == hudText[i][last])
+                {
+                    last--;
+                }
+
+                TerminalSetColors(TermColor_FFFFFF, COLOR_BORDER);
+                TerminalCursorMoveXY(column + labelLength + first, 0);
+                TerminalPrint(&text[first], last - first + 1);
+                memcpy(hudText[i], text, width);
             }
 
-            csCount = 0;
+            hudDirty &= ~(1 << i);
+        }
+
+        column += labelLength + width + HUD_GAP;
+    }
+}
+
+void GameRenderCursor()
+{
+    int16_t cursorX = cursorPosition.X - viewPosition.X;
+    int16_t cursorY = cursorPosition.Y - viewPosition.Y;
+
+    if(cursorX < 0)
+    {
+        cursorX = 0;
+    }
+    else if(cursorX >= windowSize.Width - (2 * BORDER_WIDTH))
+    {
+        cursorX = windowSize.Width - 1;
+    }
+    else
+    {
+        cursorX += BORDER_WIDTH;
+    }
+
+    if(cursorY < 0)
+    {
+        cursorY = 0;
+    }
+    else if(cursorY >= windowSize.Height - (2 * BORDER_WIDTH))
+    {
+        cursorY = windowSize.Height - 1;
+    }
+    else
+    {
+        cursorY += BORDER_WIDTH;
+    }
+    
+    TerminalCursorMoveXY(cursorX, cursorY);
+    TerminalCursorShow();
+
+    screenCursor.X = cursorX;
+    screenCursor.Y = cursorY;
+}
+
+void GameClearStatus()
+{
+    TerminalSetColors(TermColor_FFFFFF, COLOR_BORDER);
+    TerminalCursorMoveXY(0, windowSize.Height - 1);
+    TerminalInsertSpaces(windowSize.Width);
+}
+
+/*
+ * Renders a status message onto the bottom of the window
+ */
+void GameRenderStatusP(const char *status)
+{
+    GameClearStatus();
+
+    uint8_t length = strlen_P(status);
+    if(length > (windowSize.Width - (BORDER_PAD * 2)))
+    {
+        length = windowSize.Width - (BORDER_PAD * 2);
+    }
+    
+    TerminalCursorMoveXY(BORDER_PAD, windowSize.Height - 1);
+    TerminalPrintP(status, length);
+}
+
+void GameRenderStatus(const char *status)
+{
+    GameClearStatus();
+    
+    uint8_t length = strlen(status);
+    if(length > (windowSize.Width - (BORDER_PAD * 2)))
+    {
+        length = windowSize.Width - (BORDER_PAD * 2);
+    }
+    
+    TerminalCursorMoveXY(BORDER_PAD, windowSize.Height - 1);
+    TerminalPrint(status, length);
+}
+
+/*
+ * Formats a status message from a format string in program memory into the
+ * scratch arena and renders it. Messages are cut to STATUS_LENGTH - 1.
+ */
+void GameRenderStatusFormatP(const char *format, ...)
+{
+    uint16_t mark = ArenaMark();
+    char *buf = ArenaAlloc(STATUS_LENGTH);
+
+    if(buf != NULL)
+    {
+        va_list args;
+        va_start(args, format);
+        vsnprintf_P(buf, STATUS_LENGTH, format, args);
+        va_end(args);
+
+        GameRenderStatus(buf);
+    }
+
+    ArenaRelease(mark);
+}
+
+/*
+ * Parses user input
+ */
+void GameParseInput()
+{
+    while(UartBytesToReceive())
+    {
+        uint8_t b = UartReceiveByte();
+        
+        if(inputSequence.State == Input_Sequence)
+        {
+            GameParseSequenceByte(b);
+        }
+        // CCI Begin ([)
+        else if(inputSequence.State == Input_Escape)
+        {
+            if(b == 0x5B)
+            {
+                memset(&inputSequence, 0, sizeof(inputSequence));
+                inputSequence.State = Input_Sequence;
+            }
+            else
+            {
+                inputSequence.State = Input_Ground;
+            }
         }
-        // Cursor Up (w)
-        else if(b == 'w' && csCount == 0)
+        // CCI Begin (ESC)
+        else if(b == 0x1B)
         {
-            cursorPosition.Y =
-                (cursorPosition.Y == 0) ? 0 : cursorPosition.Y - 1;
+            inputSequence.State = Input_Escape;
         }
-        // Cursor Down (s)
-        else if(b == 's' && csCount == 0)
+        else
         {
-            cursorPosition.Y = (cursorPosition.Y < MAP_HEIGHT)
-                ? cursorPosition.Y + 1: cursorPosition.Y;
+            GameParseKey(b);
         }
-        // Cursor Right (d)
-        else if(b == 'd' && csCount == 0)
+    }
+}
+
+/*
+ * Collects a byte of a control sequence. Parameters are decimal numbers
+ * separated by semicolons and may be preceded by a private marker such as
+ * '?'. Intermediate bytes such as '$' come before the final byte.
+ */
+void GameParseSequenceByte(const uint8_t b)
+{
+    if(b >= '0' && b <= '9')
+    {
+        if(inputSequence.Count < INPUT_PARAMS)
         {
-            cursorPosition.X = (cursorPosition.X  < MAP_WIDTH)
-                ? cursorPosition.X + 1: cursorPosition.X;
+            uint16_t *param = &inputSequence.Params[inputSequence.Count];
+            *param = (*param < 6553) ? (*param * 10) + (b - '0') : 0xFFFF;
         }
-        // Cursor Left (a)
-        else if(b == 'a' && csCount == 0)
+    }
+    else if(b == ';')
+    {
+        if(inputSequence.Count < 0xFF)
         {
-            cursorPosition.X =
-                (cursorPosition.X == 0) ? 0 : cursorPosition.X - 1;
+            inputSequence.Count++;
         }
-        // Build button
-        else if(b == 'b' && csCount == 0)
+    }
+    else if(b >= '<' && b <= '?')
+    {
+        inputSequence.Private = b;
+    }
+    else if(b >= ' ' && b <= '/')
+    {
+        inputSequence.Intermediate = b;
+    }
+    else
+    {
+        inputSequence.State = Input_Ground;
+
+        if(b >= '@' && b <= '~')
         {
-            GameNewTower();
+            GameParseSequence(b);
         }
-        // Inspect button
-        else if(b == ' ' && csCount == 0)
-        {
-            Bot_t *bot = GameBotByPoint(cursorPosition);
+    }
+}
 
-            if(bot)
-            {
-                char buf[5];
-                sprintf(buf, "%uHP", bot->HealthPoints);
-                GameRenderStatus(buf);
-            }
-        }
-        // Begin processing the size of the terminal window
-        else if(b == '8' && csCount == 2)
+/*
+ * Acts on a complete control sequence: arrow keys and the replies to the
+ * window size request and the terminal probe
+ */
+void GameParseSequence(const char command)
+{
+    uint16_t *params = inputSequence.Params;
+
+    if(inputSequence.Private != 0 || inputSequence.Intermediate != 0)
+    {
+        // Mode report
+        if(command == 'y' && inputSequence.Private == '?'
+            && inputSequence.Intermediate == '$')
         {
-            csCount++;
+            TerminalProbeMode(params[0], params[1]);
         }
-        // First argument terminate
-        else if(b == ';' && csCount == 3)
+        // Device attributes
+        else if(command == 'c' && inputSequence.Intermediate == 0)
         {
-            csCount++;
+            TerminalProbeAttributes(inputSequence.Private, params[0]);
         }
-        // Read a numeric parameter response
-        else if(b >= '0' && b <= '9' && csCount >= 4 && csCount < 9)
+    }
+    // Down Arrow
+    else if(command == 'B')
+    {
+        if(viewPosition.Y <
+                (MAP_HEIGHT - windowSize.Height + (BORDER_WIDTH * 2))
+            && windowSize.Height < MAP_HEIGHT)
         {
-            params[0][csCount - 4] = b;
-            csCount++;
+            viewPosition.Y++;
         }
-        // Second argument terminate
-        else if(b == ';' && csCount >= 5 && csCount < 10)
+    }
+    // Up Arrow
+    else if(command == 'A')
+    {
+        // Move map up
+        viewPosition.Y = (viewPosition.Y == 0) ? 0 : viewPosition.Y - 1;
+    }
+    // Left Arrow
+    else if(command == 'D')
+    {
+        viewPosition.X = (viewPosition.X == 0) ? 0 : viewPosition.X - 1;
+    }
+    // Right Arrow
+    else if(command == 'C')
+    {
+        if(viewPosition.X <
+                (MAP_WIDTH - windowSize.Width + (BORDER_WIDTH * 2))
+            && windowSize.Width < MAP_WIDTH)
         {
-            csCount = 10;
+            viewPosition.X++;
         }
-        // Read a numeric parameter response
-        else if(b >= '0' && b <= '9' && csCount >= 10 && csCount < 15)
+    }
+    // Cursor position report
+    else if(command == 'R')
+    {
+        TerminalProbeCursor(params[1]);
+    }
+    // Terminal window size
+    else if(command == 't' && params[0] == 8)
+    {
+        uint8_t height = (params[1] > 255) ? 255 : params[1];
+        uint8_t width = (params[2] > 255) ? 255 : params[2];
+
+        if(height != windowSize.Height || width != windowSize.Width)
         {
-            params[1][csCount - 10] = b;
-            csCount++;
+            windowSize.Height = height;
+            windowSize.Width = width;
+            GameClampView();
+            TerminalSizeChanged();
         }
-        // Terminal window size changed terminate
-        else if(b == 't' && csCount >= 11 && csCount < 16)
-        {
-            uint16_t width = TERMINAL_DEF_WIDTH;
-            uint16_t height = TERMINAL_DEF_HEIGHT;
-            
-            sscanf(params[0], "%d", &height);
-            sscanf(params[1], "%d", &width);
+    }
+}
 
-            height = (height > 255) ? 255 : height;
-            width = (width > 255) ? 255 : width;
-            
-            if(windowSize.Width != width || windowSize.Height != height)
-            {
-                viewPosition.X = 0;
-                viewPosition.Y = 0;
-                windowSize.Width = width;
-                windowSize.Height = height;
-            }
-            
-            // Clear the parameter buffers
-            memset(params, 0, PARAM_COUNT * PARAM_BUF_LEN);
-            
-            csCount = 0;
-        }
-        else
+/*
+ * Keeps the view where it is unless a larger window would show past the
+ * bottom or right of the map
+ */
+void GameClampView()
+{
+    uint8_t viewWidth = windowSize.Width - (BORDER_WIDTH * 2);
+    uint8_t viewHeight = windowSize.Height - (BORDER_WIDTH * 2);
+    uint8_t maxX = (viewWidth < MAP_WIDTH) ? MAP_WIDTH - viewWidth : 0;
+    uint8_t maxY = (viewHeight < MAP_HEIGHT) ? MAP_HEIGHT - viewHeight : 0;
+
+    viewPosition.X = (viewPosition.X > maxX) ? maxX : viewPosition.X;
+    viewPosition.Y = (viewPosition.Y > maxY) ? maxY : viewPosition.Y;
+}
+
+/*
+ * Acts on a key press
+ */
+void GameParseKey(const uint8_t b)
+{
+    // Cursor Up (w)
+    if(b == 'w')
+    {
+        cursorPosition.Y =
+            (cursorPosition.Y == 0) ? 0 : cursorPosition.Y - 1;
+    }
+    // Cursor Down (s)
+    else if(b == 's')
+    {
+        cursorPosition.Y = (cursorPosition.Y < MAP_HEIGHT)
+            ? cursorPosition.Y + 1: cursorPosition.Y;
+    }
+    // Cursor Right (d)
+    else if(b == 'd')
+    {
+        cursorPosition.X = (cursorPosition.X  < MAP_WIDTH)
+            ? cursorPosition.X + 1: cursorPosition.X;
+    }
+    // Cursor Left (a)
+    else if(b == 'a')
+    {
+        cursorPosition.X =
+            (cursorPosition.X == 0) ? 0 : cursorPosition.X - 1;
+    }
+    // Build button
+    else if(b == 'b')
+    {
+        GameNewTower();
+    }
+    // Inspect button
+    else if(b == ' ')
+    {
+        uint8_t bot = GameBotByCell(CellFromPoint(cursorPosition));
+
+        if(bot != BOT_NONE)
         {
-            csCount = 0;
+            GameRenderStatusFormatP(BotHealthFormat,
+                BOT_HEALTH(botState[bot]));
         }
     }
+    // Memory button
+    else if(b == 'm')
+    {
+        GameRenderStatusFormatP(ScratchFormat, ArenaHighWater(), ARENA_SIZE);
+    }
 }
 
 /*
- * Stores a point and returns a bool indicating that there was enough space
+ * Stores a cell and the direction back to where it was reached from, and
+ * returns it or NULL if there was not enough space
  */
-VisitedPoint_t *VisitedPointStore(const Point_t *p, const uint8_t weight)
+VisitedPoint_t *VisitedPointStore(const Cell_t cell, const Direction_t back)
 {
-    if(visitedPointsCount < VISITED_POINTS_COUNT)
+    if(visitedPoints != NULL && visitedPointsCount < VISITED_POINTS_COUNT)
     {
-        visitedPoints[visitedPointsCount].Position = *p;
-        visitedPoints[visitedPointsCount].Weight = weight;
+        visitedPoints[visitedPointsCount] = cell
+            | ((VisitedPoint_t)back << VISITED_BACK_SHIFT);
         return &visitedPoints[visitedPointsCount++];
     }
 
@@ -711,21 +2113,23 @@ VisitedPoint_t *VisitedPointStore(const Point_t *p, const uint8_t weight)
 }
 
 /*
- * Clears the visited points used for path finding
+ * Clears the visited points used for path finding and takes space for them
+ * from the scratch arena. The caller releases the arena afterwards.
  */
 void VisitedPointsClear()
 {
     visitedPointsCount = 0;
+    visitedPoints = ArenaAlloc(VISITED_POINTS_COUNT * sizeof(VisitedPoint_t));
 }
 
 /*
- * Returns a visited point given a point
+ * Returns a visited point given a cell
  */
-VisitedPoint_t *VisitedPointByPoint(const Point_t *p)
+VisitedPoint_t *VisitedPointByCell(const Cell_t cell)
 {
     for(uint8_t i = 0; i < visitedPointsCount; i++)
     {
-        if(PointsEqual(visitedPoints[i].Position, *p))
+        if(VISITED_CELL(visitedPoints[i]) == cell)
         {
             return &visitedPoints[i];
         }
@@ -735,325 +2139,256 @@ VisitedPoint_t *VisitedPointByPoint(const Point_t *p)
 }
 
 /*
- * Returns a visited point adjacent to a tile with a given weight
+ * Prepares the game state before the first step
  */
-VisitedPoint_t *VisitedPointByPointWeight(const Point_t *p,
-    const uint8_t weight)
+void GameInit()
 {
-    VisitedPoint_t *visitedPoint = NULL;
-    Point_t pTest = *p;
-    if(PointAddDirection(&pTest, Direction_North))
-    {
-        visitedPoint = VisitedPointByPoint(&pTest);
-        if(visitedPoint != NULL && visitedPoint->Weight == weight)
-            return visitedPoint;
-    }
-    
-    visitedPoint = NULL;
-    pTest = *p;
-    if(!PointAddDirection(&pTest, Direction_East))
+    TimingWheelInit(&wheel, entityNext, entityDue);
+    memset(waitHeads, BOT_NONE, WAIT_BUCKETS);
+}
+
+/*
+ * Steps through the game time. Only the bots and towers that are due to act
+ * on this step are visited.
+ */
+void GameStep()
+{
+    TimingWheelTick(&wheel);
+
+#ifdef HUD_PERF
+    GameMarkHudDirty(Hud_Scratch);
+#endif
+
+    uint8_t id;
+    while((id = TimingWheelPop(&wheel)) != WHEEL_NONE)
     {
-        visitedPoint = VisitedPointByPoint(&pTest);
-        if(visitedPoint != NULL && visitedPoint->Weight == weight)
-            return visitedPoint;
+        if(id < MAX_BOTS)
+        {
+            GameStepBot(id);
+        }
+        else
+        {
+            GameStepTower(id - MAX_BOTS);
+        }
     }
     
-    visitedPoint = NULL;
-    pTest = *p;
-    if(PointAddDirection(&pTest, Direction_South))
+    // Place bots if required
+    for(uint8_t i = 0; i < ENTRY_POINT_COUNT && botCount < MAX_BOTS; i++)
     {
-        visitedPoint = VisitedPointByPoint(&pTest);
-        if(visitedPoint != NULL && visitedPoint->Weight == weight)
-            return visitedPoint;
+        GameNewBot(entryCells[i]);
     }
-    
-    visitedPoint = NULL;
-    pTest = *p;
-    if(PointAddDirection(&pTest, Direction_West))
+}
+
+/*
+ * Converts a speed from the level table into a delay in game steps
+ */
+uint8_t GameSpeedToDelay(const uint8_t speed)
+{
+    if(speed == 0)
     {
-        visitedPoint = VisitedPointByPoint(&pTest);
-        if(visitedPoint != NULL && visitedPoint->Weight == weight)
-            return visitedPoint;
+        return WHEEL_MAX_DELAY;
     }
-    
 
-    return NULL;
+    uint16_t delay = LEVEL_SPEED_SCALE / speed;
+    return (delay > WHEEL_MAX_DELAY) ? WHEEL_MAX_DELAY : delay;
 }
 
 /*
- * Steps through the game time
+ * Moves a bot towards the base and schedules its next move. Dead bots are
+ * dropped from the wheel and parked bots wait to be woken instead.
  */
-void GameStep()
+void GameStepBot(const uint8_t bot)
 {
-    // One bot is executed per game step.
-    static uint8_t i = 0;
-    
-    for(uint8_t j = 0; j < towerCount && i == 0; j++)
+    if(BOT_HEALTH(botState[bot]) == 0)
     {
-        uint8_t d = BOT_ATTACK_DISTANCE;
-        bool botInRange = FALSE;
-        uint8_t botIndex = 0;
-        
-        for(uint8_t k = 0; k < botCount; k++)
-        {
-            if(bots[k].HealthPoints > 0
-                &&PointDistance(towers[j].Position, bots[k].Position) < d)
-            {
-                botIndex = k;
-                botInRange = TRUE;
-            }
-        }
-
-        if(botInRange)
-        {
-            GameAttackBot(botIndex, GameTowerAttackDamage(&towers[j]));
-        }
+        return;
     }
-    
-    if(!GameSimpleMove(&bots[i]))
+
+    if(!GameSimpleMove(bot))
     {
-        if(!GameComplexMove(&bots[i]))
+        if(!GameComplexMove(bot))
         {
-            if(bots[i].FloodAttempts++ >= MAX_FLOOD_ATTEMPTS)
+            uint8_t floodAttempts = GameBotFloodAttempts(bot);
+            GameSetBotFloodAttempts(bot, floodAttempts + 1);
+
+            if(floodAttempts >= MAX_FLOOD_ATTEMPTS)
             {
-                uint16_t distance = PointLongestAxis(
-                    bots[i].Position, basePosition);
+                uint16_t distance = CellLongestAxis(botCells[bot], baseCell);
                 
                 if(distance >= BOT_ATTACK_DISTANCE)
                 {
-                    GameRandomizeBot(&bots[i]);
+                    GameRandomizeBot(bot);
                 }
                 else
                 {
-                    bots[i].FloodAttempts = MAX_FLOOD_ATTEMPTS;
+                    GameSetBotFloodAttempts(bot, MAX_FLOOD_ATTEMPTS);
                 }
             }
         }
     }
+
+    if(botCells[bot] & BOT_CELL_WAITING)
+    {
+        return;
+    }
+
+    TimingWheelSchedule(&wheel, bot,
+        GameSpeedToDelay(pgm_read_byte(&(levels[level].MoveSpeed))));
+}
+
+/*
+ * Attacks the in-range bot closest to the base and schedules the next attack
+ */
+void GameStepTower(const uint8_t tower)
+{
+    bool botInRange = FALSE;
+    uint8_t botIndex = 0;
+    uint8_t botDistance = 0;
+    Cell_t towerCell = towers[tower].Cell;
+    uint8_t towerX = CellToPoint(towerCell).X;
     
-    i++;
-    i %= botCount;
-    
-    // Place bots if required
-    for(uint8_t i = 0; i < ENTRY_POINT_COUNT && botCount < MAX_BOTS; i++)
+    for(uint8_t k = 0; k < botCount; k++)
+    {
+        // Cells further apart than this cannot be within range
+        Cell_t botCell = BOT_CELL(botCells[k]);
+        int16_t span = botCell - towerCell;
+        if(GameAbs(span) > (BOT_ATTACK_DISTANCE - 1) * (MAP_WIDTH + 1))
+        {
+            continue;
+        }
+
+        if(BOT_HEALTH(botState[k]) > 0
+            && CellNearDistance(towerCell, towerX, botCell,
+                BOT_ATTACK_DISTANCE) < BOT_ATTACK_DISTANCE)
+        {
+            // Target the bot with the shortest walk left to the base
+            uint8_t distance = GameBaseDistance(botCell);
+
+            if(!botInRange || distance < botDistance)
+            {
+                botIndex = k;
+                botDistance = distance;
+                botInRange = TRUE;
+            }
+        }
+    }
+
+    if(botInRange)
     {
-        GameNewBot(entryPoints[i]);
+        GameAttackBot(botIndex, GameTowerAttackDamage(&towers[tower]));
     }
 
-    GameRenderCursor();
+    TimingWheelSchedule(&wheel, ENTITY_TOWER(tower),
+        GameSpeedToDelay(pgm_read_byte(&(levels[level].AttackSpeed))));
 }
 
 /*
  * Attempts to move the bot closer to the base by moving in the longest of
  * either x and y. Returns a bool indicating whether it was possible to move.
+ * A bot that is only held up by other bots is parked until they move on.
  */
-bool GameSimpleMove(Bot_t *bot)
+bool GameSimpleMove(const uint8_t bot)
 {
-    int16_t deltaX = bot->Position.X - basePosition.X;
-    int16_t deltaY = bot->Position.Y - basePosition.Y;
+    Point_t p = CellToPoint(botCells[bot]);
+    int16_t deltaX = p.X - basePosition.X;
+    int16_t deltaY = p.Y - basePosition.Y;
 
     uint16_t absDeltaX = GameAbs(deltaX);
     uint16_t absDeltaY = GameAbs(deltaY);
 
-    if(absDeltaX > absDeltaY)
+    Direction_t directionX = (deltaX > 0) ? Direction_West : Direction_East;
+    Direction_t directionY = (deltaY > 0) ? Direction_North : Direction_South;
+    
+    Direction_t primary = (absDeltaX > absDeltaY) ? directionX : directionY;
+    Direction_t secondary = (absDeltaX > absDeltaY) ? directionY : directionX;
+
+    if(GameMoveBot(bot, primary) || GameMoveBot(bot, secondary))
     {
-        if(deltaX > 0)
-        {
-            if(GameMoveBot(bot, Direction_West))
-            {
-                return TRUE;
-            }
-            else
-            {
-                if(deltaY > 0)
-                {
-                    return GameMoveBot(bot, Direction_North);
-                }
-                else
-                {
-                    return GameMoveBot(bot, Direction_South);
-                }
-            }
-        }
-        else
-        {
-            if(GameMoveBot(bot, Direction_East))
-            {
-                return TRUE;
-            }
-            else
-            {
-                if(deltaY > 0)
-                {
-                    return GameMoveBot(bot, Direction_North);
-                }
-                else
-                {
-                    return GameMoveBot(bot, Direction_South);
-                }
-            }
-        }
+        return TRUE;
     }
-    else
+
+    Cell_t cellTest = CellNeighbor(botCells[bot], primary);
+    if(cellTest != CELL_NONE && GameBotByCell(cellTest) != BOT_NONE)
     {
-        if(deltaY > 0)
-        {
-            if(GameMoveBot(bot, Direction_North))
-            {
-                return TRUE;
-            }
-            else
-            {
-                if(deltaX > 0)
-                {
-                    return GameMoveBot(bot, Direction_West);
-                }
-                else
-                {
-                    return GameMoveBot(bot, Direction_East);
-                }
-            }
-        }
-        else
-        {
-            if(GameMoveBot(bot, Direction_South))
-            {
-                return TRUE;
-            }
-            else
-            {
-                if(deltaX > 0)
-                {
-                    return GameMoveBot(bot, Direction_West);
-                }
-                else
-                {
-                    return GameMoveBot(bot, Direction_East);
-                }
-            }
-        }
+        return GameParkBot(bot, primary);
+    }
+
+    cellTest = CellNeighbor(botCells[bot], secondary);
+    if(cellTest != CELL_NONE && GameBotByCell(cellTest) != BOT_NONE)
+    {
+        return GameParkBot(bot, secondary);
     }
+
+    return FALSE;
 }
 
 /*
  * Attempts to move a bot using wave propagation path finding.
  */
-bool GameComplexMove(Bot_t *bot)
+bool GameComplexMove(const uint8_t bot)
 {
-    if(bot->FloodAttempts < MAX_FLOOD_ATTEMPTS)
+    if(GameBotFloodAttempts(bot) < MAX_FLOOD_ATTEMPTS)
     {
+        Cell_t botCell = botCells[bot];
+        uint16_t mark = ArenaMark();
         VisitedPointsClear();
-        VisitedPointStore(&bot->Position, 0);
+        VisitedPointStore(botCell, Direction_North);
         
         VisitedPoint_t *destinationPoint = NULL;
         
-        for(uint8_t i = 0; i < visitedPointsCount; i++)
+        for(uint8_t i = 0; i < visitedPointsCount
+            && destinationPoint == NULL; i++)
         {
-            VisitedPoint_t *visitedPoint = &visitedPoints[i];
-            Point_t p = visitedPoint->Position;
-
-            if(PointAddDirection(&p, Direction_North)
-                && GameGetTile(p) != Tile_Stone
-                && !VisitedPointByPoint(&p)
-                && !GameTowerByPoint(p))
-            {
-                VisitedPoint_t *storedPoint = VisitedPointStore(&p,
-                    visitedPoint->Weight + 1);
-                
-                if(storedPoint == NULL)
-                {
-                    return FALSE;
-                }
-                
-                if(PointsEqual(p, basePosition))
-                {
-                    destinationPoint = storedPoint;
-                    break;
-                }
-            }
-            
-            p = visitedPoint->Position;
-            
-            if(PointAddDirection(&p, Direction_East)
-                && p.X < MAP_WIDTH
-                && GameGetTile(p) != Tile_Stone
-                && !VisitedPointByPoint(&p)
-                && !GameTowerByPoint(p))
-            {
-                VisitedPoint_t *storedPoint = VisitedPointStore(&p,
-                    visitedPoint->Weight + 1);
-
-                if(storedPoint == NULL)
-                {
-                    return FALSE;
-                }
-                
-                if(PointsEqual(p, basePosition))
-                {
-                    destinationPoint = storedPoint;
-                    break;
-                }
-            }
-            
-            p = visitedPoint->Position;
-            
-            if(PointAddDirection(&p, Direction_South)
-                && p.Y < MAP_HEIGHT
-                && GameGetTile(p) != Tile_Stone
-                && !VisitedPointByPoint(&p)
-                && !GameTowerByPoint(p))
-            {
-                VisitedPoint_t *storedPoint = VisitedPointStore(&p,
-                    visitedPoint->Weight + 1);
+            Cell_t visitedCell = VISITED_CELL(visitedPoints[i]);
 
-                if(storedPoint == NULL)
-                {
-                    return FALSE;
-                }
-
-                if(PointsEqual(p, basePosition))
-                {
-                    destinationPoint = storedPoint;
-                    break;
-                }
-            }
-            
-            p = visitedPoint->Position;
-            
-            if(PointAddDirection(&p, Direction_West)
-                && GameGetTile(p) != Tile_Stone
-                && !VisitedPointByPoint(&p)
-                && !GameTowerByPoint(p))
+            for(Direction_t d = Direction_North; d <= Direction_West; d++)
             {
-                VisitedPoint_t *storedPoint = VisitedPointStore(&p,
-                    visitedPoint->Weight + 1);
-
-                if(storedPoint == NULL)
-                {
-                    return FALSE;
-                }
+                Cell_t cell = CellNeighbor(visitedCell, d);
 
-                if(PointsEqual(p, basePosition))
+                if(cell != CELL_NONE
+                    && GameGetTile(cell) != Tile_Stone
+                    && !VisitedPointByCell(cell)
+                    && !GameTowerByCell(cell))
                 {
-                    destinationPoint = storedPoint;
-                    break;
+                    VisitedPoint_t *storedPoint = VisitedPointStore(cell,
+                        DIRECTION_OPPOSITE(d));
+                    
+                    if(storedPoint == NULL)
+                    {
+                        ArenaRelease(mark);
+                        return FALSE;
+                    }
+                    
+                    if(cell == baseCell)
+                    {
+                        destinationPoint = storedPoint;
+                        break;
+                    }
                 }
             }
         }
         
-        while(destinationPoint != NULL && destinationPoint->Weight > 1)
+        // Follow the way back until the cell next to the bot
+        Cell_t destinationCell = CELL_NONE;
+        while(destinationPoint != NULL)
         {
-            destinationPoint =
-                VisitedPointByPointWeight(&destinationPoint->Position,
-                    destinationPoint->Weight - 1);
+            destinationCell = VISITED_CELL(*destinationPoint);
+            Cell_t previousCell = CellNeighbor(destinationCell,
+                VISITED_BACK(*destinationPoint));
+
+            destinationPoint = (previousCell != botCell)
+                ? VisitedPointByCell(previousCell) : NULL;
         }
 
-        if(destinationPoint != NULL)
+        // Release the search before rendering so formatting can use the arena
+        ArenaRelease(mark);
+
+        if(destinationCell != CELL_NONE)
         {
-            GameRenderTilePosition(bot->Position);
-            bot->Position = destinationPoint->Position;
-            GameRenderBot(bot);
-            bot->FloodAttempts = 0;
+            GameMarkMoveDirty(botCell, destinationCell);
+            botCells[bot] = destinationCell;
+            GameSetBotFloodAttempts(bot, 0);
+            GameWakeBots(botCell);
             
             return TRUE;
         }
@@ -1067,65 +2402,49 @@ uint16_t GameAbs(int16_t v)
     return (v < 0) ? -v : v;
 }
 
-void GameRandomizeBot(Bot_t *bot)
+/*
+ * Moves a bot to a random walkable tile that is not the base or occupied
+ */
+void GameRandomizeBot(const uint8_t bot)
 {
-    while(1)
-    {
-        uint8_t randX = MAP_WIDTH;
-        uint8_t randY = MAP_HEIGHT;
-
-        while(randX >= MAP_WIDTH)
-        {
-            randX = RandGetByte();
-        }
-        
-        while(randY >= MAP_HEIGHT)
-        {
-            randY = RandGetByte();
-        }
+    uint16_t walkableCount = pgm_read_word(&(mapWalkableRank[MAP_HEIGHT]));
+    Cell_t cell;
 
-        Point_t p = { .X = randX,
-                      .Y = randY };
-        
-        if(PointsEqual(p, basePosition)
-            || GameGetTile(p) == Tile_Stone
-            || GameBotByPoint(p))
-        {
-            continue;
-        }
-        
-        GameRenderTilePosition(bot->Position);
-        bot->Position = p;
-        GameRenderBot(bot);
-        bot->FloodAttempts = 0;
-        break;
-    }
+    do
+    {
+        cell = GameWalkableCell(RandGetBelow(walkableCount));
+    } while(cell == baseCell || GameBotByCell(cell) != BOT_NONE);
+
+    Cell_t cellPrev = botCells[bot];
+    GameMarkMoveDirty(cellPrev, cell);
+    botCells[bot] = cell;
+    GameSetBotFloodAttempts(bot, 0);
+    GameWakeBots(cellPrev);
 }
 
-bool GameMoveBot(Bot_t *bot, Direction_t direction)
+bool GameMoveBot(const uint8_t bot, Direction_t direction)
 {
-    Point_t pTest = bot->Position;
-    if(!PointAddDirection(&pTest, direction)
-        || pTest.X >= MAP_WIDTH
-        || pTest.Y >= MAP_HEIGHT
-        || GameGetTile(pTest) == Tile_Stone
-        || GameTowerByPoint(pTest))
+    Cell_t cellPrev = botCells[bot];
+    Cell_t cellTest = CellNeighbor(cellPrev, direction);
+    if(cellTest == CELL_NONE
+        || GameGetTile(cellTest) == Tile_Stone
+        || GameTowerByCell(cellTest))
     {
         return FALSE;
     }
-    else if(PointsEqual(pTest, basePosition))
+    else if(cellTest == baseCell)
     {
         return TRUE;
     }
-    else if(GameBotByPoint(pTest))
+    else if(GameBotByCell(cellTest) != BOT_NONE)
     {
-        return (bot->FloodAttempts >= MAX_FLOOD_ATTEMPTS);
+        return FALSE;
     }
     else
     {
-        GameRenderTilePosition(bot->Position);
-        PointAddDirection(&bot->Position, direction);
-        GameRenderBot(bot);
+        GameMarkMoveDirty(cellPrev, cellTest);
+        botCells[bot] = cellTest;
+        GameWakeBots(cellPrev);
         return TRUE;
     }
 }
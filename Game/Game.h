@@ -9,17 +9,19 @@
 #define GAME_H
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
 #include <avr/pgmspace.h>
 
 #include "Uart.h"
 #include "Point.h"
+#include "Cell.h"
 #include "Size.h"
 #include "Terminal.h"
 #include "Rand.h"
-
-#define MAP_WIDTH 121
-#define MAP_HEIGHT 48
+#include "TimingWheel.h"
+#include "Arena.h"
+#include "Shadow.h"
 
 #define BORDER_WIDTH 1
 #define BORDER_PAD 4
@@ -37,15 +39,47 @@
 
 #define BOT_ATTACK_DISTANCE 6
 
-#define MAX_BOTS 32
-#define MAX_TOWERS 128
+#define MAX_BOTS 128
+#define MAX_TOWERS 64
+#define BOT_NONE 0xFF
+
+/*
+ * Bots and towers share one timing wheel. Bots use their index as the entity
+ * id and towers are offset by MAX_BOTS.
+ */
+#define ENTITY_COUNT (MAX_BOTS + MAX_TOWERS)
+#define ENTITY_TOWER(i) (MAX_BOTS + (i))
 
 #define MAX_FLOOD_ATTEMPTS 5
 #define BOT_CHAR '%'
 #define BASE_CHAR ' '
 
-#define PARAM_BUF_LEN 5
-#define PARAM_COUNT 2
+#define VISITED_POINTS_COUNT 120
+
+/*
+ * The longest formatted status message, with its terminator
+ */
+#define STATUS_LENGTH 24
+
+/*
+ * Control sequences sent by the terminal are collected a byte at a time
+ * until their final byte. Parameters after the first few are dropped.
+ */
+#define INPUT_PARAMS 3
+
+typedef enum InputState_t {
+    Input_Ground,
+    Input_Escape,
+    Input_Sequence
+} InputState_t;
+
+typedef struct InputSequence_t {
+    InputState_t State;
+    char Private;
+    char Intermediate;
+    uint8_t Count;
+    uint16_t Params[INPUT_PARAMS];
+} InputSequence_t;
 
 /* Map Tiles ******************************************************************/
 
@@ -59,53 +93,270 @@ typedef enum TileType_t {
 TermColor_t GameGetTileBgColor(const TileType_t t);
 TermColor_t GameGetTileFgColor(const TileType_t t);
 char GameGetTileCharacter(const TileType_t t);
-TileType_t GameGetTile(const Point_t p);
+
+/*
+ * What is drawn in a map cell, as an index into the style table and a
+ * character. The entity styles follow the tile styles.
+ */
+typedef uint16_t Glyph_t;
+
+#define GLYPH(style, c) (((Glyph_t)(style) << 8) | (uint8_t)(c))
+#define GLYPH_STYLE(glyph) ((glyph) >> 8)
+#define GLYPH_CHAR(glyph) ((char)((glyph) & 0xFF))
+
+#define STYLE_BASE (Tile_Grass + 1)
+#define STYLE_BOT (Tile_Grass + 2)
+#define STYLE_TOWER (Tile_Grass + 3)
+
+/*
+ * The layers that can be drawn in a map cell, from bottom to top
+ */
+typedef enum Layer_t {
+    Layer_Terrain,
+    Layer_Base,
+    Layer_Bot,
+    Layer_Tower
+} Layer_t;
+
+#define LAYER_MASK 0x03
+#define LAYER_LEVEL_SHIFT 2
+TileType_t GameGetTile(const Cell_t cell);
+Cell_t GameWalkableCell(const uint16_t index);
+uint8_t GameBaseDistance(const Cell_t cell);
 
 /* Towers *********************************************************************/
 
 typedef struct Tower_t {
-    Point_t Position;
+    Cell_t Cell;
     uint8_t Level;
 } Tower_t;
 
-Tower_t *GameTowerByPoint(const Point_t p);
+Tower_t *GameTowerByCell(const Cell_t cell);
 uint8_t GameTowerAttackDamage(Tower_t *tower);
 void GameNewTower();
 
 /* Bots ***********************************************************************/
 
-typedef struct Bot_t {
-    uint8_t HealthPoints;
-    Point_t Position;
-    uint8_t FloodAttempts;
-} Bot_t;
-
-void GameNewBot(const Point_t p);
-void GameRandomizeBot(Bot_t *bot);
-Bot_t *GameBotByPoint(const Point_t p);
+/*
+ * Bots are stored as a struct of arrays indexed by bot number, three bytes
+ * each. A bot is a cell index and a state byte that holds its health points
+ * above the flood attempt counter, so health is capped at BOT_HEALTH_MAX. A
+ * bot blocked by another bot is parked on a wait list, which is flagged in
+ * the bits of its cell above the largest cell along with the direction of
+ * the cell it needs. Only parked bots have these bits set, so they are
+ * cleared when a bot is woken.
+ */
+#define BOT_CELL_MASK 0x1FFF
+#define BOT_CELL_DIRECTION_SHIFT 13
+#define BOT_CELL_DIRECTION_MASK (0x03 << BOT_CELL_DIRECTION_SHIFT)
+#define BOT_CELL_WAITING 0x8000
+#define BOT_CELL(c) ((Cell_t)((c) & BOT_CELL_MASK))
+
+#define BOT_STATE_FLOOD_MASK 0x07
+#define BOT_STATE_HEALTH_SHIFT 3
+#define BOT_HEALTH(state) ((state) >> BOT_STATE_HEALTH_SHIFT)
+#define BOT_HEALTH_MAX 31
+
+#define WAIT_BUCKETS 16
+
+void GameNewBot(const Cell_t cell);
+void GameRandomizeBot(const uint8_t bot);
+uint8_t GameBotByCell(const Cell_t cell);
+uint8_t GameBotFloodAttempts(const uint8_t bot);
+void GameSetBotFloodAttempts(const uint8_t bot, const uint8_t attempts);
 void GameAttackBot(const uint8_t botIndex, const uint8_t damage);
 
+bool GameParkBot(const uint8_t bot, const Direction_t direction);
+Cell_t GameBotWaitCell(const uint8_t bot);
+void GameWakeBots(const Cell_t cell);
+
 /* Rendering and UI ***********************************************************/
 
+/*
+ * Cells changed by the simulation are collected in a small set and drawn
+ * once per frame. At flush time each entry is keyed by row, style and
+ * column, which fit in 16 bits for maps up to 64 rows of 128 columns.
+ */
+#define DIRTY_CELLS 24
+
+#define DIRTY_KEY(y, style, x) \
+    (((uint16_t)(y) << 10) | ((uint16_t)(style) << 7) | (x))
+#define DIRTY_KEY_Y(key) ((key) >> 10)
+#define DIRTY_KEY_X(key) ((key) & 0x7F)
+
+typedef struct DirtyEntry_t {
+    uint16_t Key;
+    Glyph_t Glyph;
+    uint8_t Id;
+} DirtyEntry_t;
+
+/*
+ * Drawing never waits on the serial link. Each piece of output is only
+ * started when the transmit buffer has room for the most it can send, and
+ * is otherwise left for a later frame. These are the worst case sizes of a
+ * run of map cells, a pan, a field of the top border, a row erased after a
+ * resize and a row shifted by a pan without margins. A field of the top
+ * border is its colors, a cursor move and the widest field. Room is always
+ * kept for the cursor and the end of a synchronized update.
+ */
+#define RENDER_RUN_BYTES 48
+#define RENDER_PAN_BYTES 72
+#define RENDER_HUD_BYTES \
+    (TERM_STYLE_LENGTH + TERM_MOVE_LENGTH + HUD_FIELD_WIDTH)
+#define RENDER_ERASE_BYTES 32
+#define RENDER_SHIFT_BYTES 48
+#define RENDER_END_BYTES 24
+
+/*
+ * A run of map cells is ended after this many cells when each is sent as its
+ * own character, so that it stays within RENDER_RUN_BYTES with the cursor
+ * move and style in front of it.
+ */
+#define RENDER_RUN_CELLS 16
+
+/*
+ * Between frames map cells are only drawn while this much more is left for
+ * the next frame, so that the map does not crowd out the cursor and HUD.
+ */
+#define RENDER_PENDING_RESERVE 32
+
+/*
+ * A rectangle of map cells waiting to be drawn, in map coordinates so that
+ * it stays valid when the view pans. X and Y are where drawing resumes.
+ */
+typedef struct MapJob_t {
+    bool Active;
+    uint8_t Left;
+    uint8_t Top;
+    uint8_t Right;
+    uint8_t Bottom;
+    uint8_t X;
+    uint8_t Y;
+} MapJob_t;
+
+/*
+ * The top border shows a row of labelled numbers. Each field has a fixed
+ * width and is marked dirty when its value changes. Only the characters
+ * that differ from what is on screen are sent. Build with HUD_PERF to also
+ * show the scratch arena high water mark.
+ */
+#define HUD_FIELD_WIDTH 6
+
+typedef enum HudFieldId_t {
+    Hud_Gold,
+    Hud_Level,
+    Hud_Bots,
+#ifdef HUD_PERF
+    Hud_Scratch,
+#endif
+    Hud_FieldCount
+} HudFieldId_t;
+
+typedef struct HudField_t {
+    const char *Label;
+    uint8_t LabelLength;
+    uint8_t Width;
+} HudField_t;
+
+/*
+ * Cells that spill from a full dirty set go to a few small jobs of their own
+ * rather than growing the map job. A cell joins the spill job that grows
+ * the least, or a free one when that would add more than SPILL_MERGE_CELLS.
+ */
+#define SPILL_JOBS 4
+#define SPILL_MERGE_CELLS 16
+
+/*
+ * Render profiles trade detail for bytes when the link can not keep up.
+ * Reduced sends the 16 basic colors and terrain without its characters, and
+ * minimal also draws entities every other step. The link is behind when
+ * entities, pans or the border had to wait for it, and the profile steps
+ * down after that has gone on for a number of game steps. It steps back up
+ * once the link has been using under half of its measured capacity for a
+ * longer while, which doubles after each drop up to the maximum.
+ */
+typedef enum RenderProfile_t {
+    Profile_Full,
+    Profile_Reduced,
+    Profile_Minimal
+} RenderProfile_t;
+
+#define PROFILE_DOWN_STEPS 8
+#define PROFILE_UP_STEPS 64
+#define PROFILE_UP_STEPS_MAX 1024
+
+/*
+ * Changes are collected between frames and a frame is drawn at most once
+ * per this many timer ticks, about 60 per second. No frame is drawn while
+ * more input is waiting so that a burst of key presses is drawn once. Map
+ * cells waiting to be drawn are sent between frames as the link allows.
+ */
+#define FRAME_TICKS 256
+
 void GameRender();
-void GameRenderTile(const TileType_t tile);
-void GameRenderTilePosition(const Point_t p);
+void GameRenderPending();
+bool GameScreenSettled();
 void GameRenderMap();
-void GameRenderBot(const Bot_t *bot);
-void GameRenderTowers();
-void GameRenderTower(const Tower_t *tower);
-void GameRenderBots();
-void GameRenderBase();
+bool GameLinkHasRoom(const uint8_t bytes);
+void GameUpdateProfile();
+void GameSetProfile(const RenderProfile_t profile);
+void GameMarkDirty(const Cell_t cell);
+void GameMarkMoveDirty(const Cell_t from, const Cell_t to);
+void GameReserveDirty(const uint8_t count);
+void GameAddDirty(const Cell_t cell);
+void GameRenderDirty();
+void GameQueueDirty();
+void GameRenderGlyphRun(const Glyph_t glyph, const uint8_t count);
+void GameRenderGlyph(const Point_t p, const Glyph_t glyph);
+bool GameShadowUpdate(const uint8_t x, const uint8_t y, const Glyph_t glyph);
+uint8_t GameGlyphShadowId(const Glyph_t glyph);
+void GameQueueMap();
+void GameQueueViewRect(const uint8_t left, const uint8_t top,
+    const uint8_t width, const uint8_t height);
+void GameQueueMapRect(const uint8_t left, const uint8_t top,
+    const uint8_t right, const uint8_t bottom);
+void GameJobAddRect(MapJob_t *job, const uint8_t left, const uint8_t top,
+    const uint8_t right, const uint8_t bottom);
+void GameQueueSpill(const Cell_t cell);
+bool GameMapJobsActive();
+void GameClearMapJobs();
+void GameRenderMapJob();
+bool GameRenderJob(MapJob_t *job);
+#ifdef MAP_CHUNKS
+uint8_t GameMapChunkWidth(const uint8_t x, const uint8_t y,
+    const uint8_t right, const uint8_t *layers);
+uint8_t GameRenderMapChunk(const uint8_t x, const uint8_t y);
+#endif
+void GameFillLayers(uint8_t *layers, const Cell_t cell, const uint8_t count);
+Glyph_t GameCellGlyphAt(const Cell_t cell);
+Glyph_t GameCellGlyph(const Cell_t cell, const uint8_t layer);
+bool GameRenderPan();
+bool GameRenderPanRows();
+bool GameRenderResize(const Size_t *prevSize);
 void GameRenderBorders();
+void GameMarkHudDirty(const HudFieldId_t field);
+uint32_t GameHudValue(const HudFieldId_t field);
+void GameRenderHud();
 void GameRenderCursor();
 void GameClearStatus();
 void GameRenderStatusP(const char *status);
 void GameRenderStatus(const char *status);
+void GameRenderStatusFormatP(const char *format, ...);
 
 void GameParseInput();
+void GameParseSequenceByte(const uint8_t b);
+void GameParseSequence(const char command);
+void GameClampView();
+void GameParseKey(const uint8_t b);
 
 /* Levels *********************************************************************/
 
+/*
+ * Move and attack speeds are the number of actions taken per
+ * LEVEL_SPEED_SCALE game steps.
+ */
+#define LEVEL_SPEED_SCALE 256
+
 typedef struct LevelSpec_t {
     const char *LevelName;
     uint8_t MoveSpeed;
@@ -117,24 +368,32 @@ typedef struct LevelSpec_t {
 
 /* Path Finding ***************************************************************/
 
-typedef struct VisitedPoint_t {
-    Point_t Position;
-    uint8_t Weight;
-} VisitedPoint_t;
+/*
+ * A cell reached by the search, packed with the direction back to the cell
+ * it was reached from in the bits above the largest cell
+ */
+typedef uint16_t VisitedPoint_t;
+
+#define VISITED_CELL_MASK 0x3FFF
+#define VISITED_BACK_SHIFT 14
+#define VISITED_CELL(p) ((Cell_t)((p) & VISITED_CELL_MASK))
+#define VISITED_BACK(p) ((Direction_t)((p) >> VISITED_BACK_SHIFT))
 
-VisitedPoint_t *VisitedPointStore(const Point_t *p, const uint8_t weight);
+VisitedPoint_t *VisitedPointStore(const Cell_t cell, const Direction_t back);
 void VisitedPointsClear();
 
-VisitedPoint_t *VisitedPointByPoint(const Point_t *p);
-VisitedPoint_t *VisitedPointByPointWeight(const Point_t *p,
-    const uint8_t weight);
+VisitedPoint_t *VisitedPointByCell(const Cell_t cell);
 
 /* Time Stepping **************************************************************/
 
+void GameInit();
 void GameStep();
+uint8_t GameSpeedToDelay(const uint8_t speed);
+void GameStepBot(const uint8_t bot);
+void GameStepTower(const uint8_t tower);
 uint16_t GameAbs(int16_t v);
-bool GameSimpleMove(Bot_t *bot);
-bool GameComplexMove(Bot_t *bot);
-bool GameMoveBot(Bot_t *bot, Direction_t direction);
+bool GameSimpleMove(const uint8_t bot);
+bool GameComplexMove(const uint8_t bot);
+bool GameMoveBot(const uint8_t bot, Direction_t direction);
 
 #endif
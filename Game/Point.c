@@ -21,42 +21,6 @@ Point_t PointAdd(const Point_t p1, const Point_t p2)
     return p;
 }
 
-/*
- * Adds a direction to a point
- */
-bool PointAddDirection(Point_t *p, const Direction_t d)
-{
-    switch(d)
-    {
-        case Direction_North:
-            if(p->Y == 0)
-                return FALSE;
-            
-            p->Y--;
-            break;
-        case Direction_East:
-            if(p->X == 255)
-                return FALSE;
-            
-            p->X++;
-            break;
-        case Direction_South:
-            if(p->Y == 255)
-                return FALSE;
-            
-            p->Y++;
-            break;
-        case Direction_West:
-            if(p->X == 0)
-                return FALSE;
-            
-            p->X--;
-            break;
-    }
-
-    return TRUE;
-}
-
 bool PointInSize(const Point_t *p, const Size_t *s)
 {
     return (p->X < s->Width && p->Y < s->Height);
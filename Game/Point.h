@@ -11,7 +11,6 @@
 #include <avr/pgmspace.h>
 
 #include "Bool.h"
-#include "Direction.h"
 #include "Size.h"
 
 typedef struct Point_t {
@@ -21,7 +20,6 @@ typedef struct Point_t {
 
 bool PointsEqual(const Point_t p1, const Point_t p2);
 Point_t PointAdd(const Point_t p1, const Point_t p2);
-bool PointAddDirection(Point_t *p, const Direction_t d);
 bool PointInSize(const Point_t *p, const Size_t *s);
 uint8_t PointLongestAxis(const Point_t p1, const Point_t p2);
 uint8_t PointDistance(const Point_t p1, const Point_t p2);
@@ -5,50 +5,157 @@
 #include "Rand.h"
 
 /*
- * Configures the ADC to produce random numbers
+ * State of the xorshift generator. Never zero once seeded.
+ */
+uint32_t randState;
+
+/* Entropy Pool ***************************************************************/
+
+volatile CircularBuffer_t entropyPool;
+uint8_t entropyData[RAND_POOL_SIZE];
+
+/*
+ * Configures the ADC and seeds the generator. When RAND_SEED is defined the
+ * seed is fixed so that runs can be reproduced and the entropy pool is not
+ * used. Otherwise the seed is taken from the pool, which requires interrupts
+ * to be enabled.
  */
 void RandInit()
 {
+#ifdef RAND_SEED
+    RandSeed(RAND_SEED);
+#else
+    entropyPool.Size = RAND_POOL_SIZE;
+    entropyPool.Buf = entropyData;
+
     ADMUX = (1 << REFS1) | (1 << REFS0) | (1 << ADLAR);
+    ADCSRB = 0;
     ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1);
+    RandStartPool();
+    EnableInterrupts(TRUE);
+
+    uint32_t seed = 0;
+
+    for(uint8_t i = 0; i < sizeof(seed); i++)
+    {
+        while(CircularBufferIsEmpty(&entropyPool));
+        seed = (seed << 8) | RandGetByte();
+    }
+
+    RandSeed(seed);
+#endif
 }
 
-bool RandGetBit()
+/*
+ * Seeds the generator. A zero seed would lock the generator at zero so it is
+ * replaced with one.
+ */
+void RandSeed(uint32_t seed)
 {
-    bool firstRead = FALSE;
-    bool secondRead = FALSE;
+    randState = (seed == 0) ? 1 : seed;
+}
+
+/*
+ * Puts the ADC into free-running mode to refill the entropy pool. Does
+ * nothing if it is already running.
+ */
+void RandStartPool()
+{
+    if(!(ADCSRA & (1 << ADATE)))
+    {
+        ADCSRA |= (1 << ADATE) | (1 << ADIE) | (1 << ADSC);
+    }
+}
+
+/*
+ * ADC conversion complete interrupt handler. The least significant bits of
+ * pairs of conversions are debiased and collected into bytes for the pool.
+ * The ADC is stopped once the pool is full.
+ */
+void __attribute__((signal)) ADC_vect(void)
+{
+    static uint8_t firstBit = RAND_NO_BIT;
+    static uint8_t value;
+    static uint8_t bitCount;
+
+    uint8_t bit = ADCH & 0x01;
+
+    if(firstBit == RAND_NO_BIT)
+    {
+        firstBit = bit;
+        return;
+    }
     
-    while(firstRead == secondRead)
+    if(firstBit != bit)
     {
-        firstRead = RandGetUnfilteredBit();
-        secondRead = RandGetUnfilteredBit();
+        value = (value << 1) | firstBit;
+
+        if(++bitCount == 8)
+        {
+            CircularBufferWrite(&entropyPool, value);
+            bitCount = 0;
+
+            if(CircularBufferIsFull(&entropyPool))
+            {
+                ADCSRA &= ~((1 << ADATE) | (1 << ADIE));
+            }
+        }
     }
 
-    return firstRead;
+    firstBit = RAND_NO_BIT;
 }
 
+/* Random Numbers *************************************************************/
+
 /*
- * Makes a conversion and returns the least significant digit of the result
+ * Advances the xorshift generator and returns the new state
  */
-bool RandGetUnfilteredBit()
+uint32_t RandNext()
 {
-    // Start a conversion
-    ADCSRA |= (1 << ADSC);
-    while(ADCSRA & (1 << ADSC));
-    return (ADCH & 0x01);
+    uint32_t x = randState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randState = x;
+    return x;
 }
 
 /*
- * Returns a random byte
+ * Returns a random byte. Bytes from the entropy pool are used when there are
+ * any, otherwise the generator is used, so this never waits on the ADC.
  */
 uint8_t RandGetByte()
 {
-    uint8_t value = 0;
+#ifndef RAND_SEED
+    bool interruptsState = DisableInterrupts();
 
-    for(uint8_t i = 0; i < 8; i++)
+    if(!CircularBufferIsEmpty(&entropyPool))
     {
-        value |= (RandGetBit() << i);
+        uint8_t b = CircularBufferRead(&entropyPool);
+        RandStartPool();
+        EnableInterrupts(interruptsState);
+        return b;
     }
 
-    return value;
+    EnableInterrupts(interruptsState);
+#endif
+
+    return RandNext() >> 24;
+}
+
+/*
+ * Returns a random 16-bit word
+ */
+uint16_t RandGetWord()
+{
+    return ((uint16_t)RandGetByte() << 8) | RandGetByte();
+}
+
+/*
+ * Returns a random number in the range [0, bound) using a single word. The
+ * word is scaled rather than rejected so the cost is always bounded.
+ */
+uint16_t RandGetBelow(uint16_t bound)
+{
+    return ((uint32_t)RandGetWord() * bound) >> 16;
 }
@@ -1,5 +1,12 @@
 /*
- * ADC based random number generator for AVR microcontrollers
+ * Random number generator for AVR microcontrollers
+ *
+ * The ADC runs in free-running mode and an interrupt handler collects the
+ * noise in the least significant bit of each conversion into a small entropy
+ * pool. Random bytes come from the pool when it has any and from a xorshift
+ * generator otherwise. The generator is seeded from the pool at startup, or
+ * from RAND_SEED when it is defined, which also leaves the pool unused so
+ * that runs are reproducible.
  */
 
 #ifndef RAND_H
@@ -9,11 +16,19 @@
 #include <stdint.h>
 
 #include "Bool.h"
+#include "CircularBuffer.h"
+#include "Interrupts.h"
+
+#define RAND_POOL_SIZE 8
+#define RAND_NO_BIT 0xFF
 
 void RandInit();
-bool RandGetBit();
-bool RandGetUnfilteredBit();
+void RandSeed(uint32_t seed);
+void RandStartPool();
+uint32_t RandNext();
 uint8_t RandGetByte();
+uint16_t RandGetWord();
+uint16_t RandGetBelow(uint16_t bound);
 
 
 #endif
@@ -0,0 +1,138 @@
+/*
+ * Shadow of the map view implementation
+ */
+
+#include "Shadow.h"
+
+#ifdef SHADOW_ROWS
+
+uint8_t shadowCells[SHADOW_ROWS][SHADOW_ROW_BYTES];
+
+/*
+ * Marks every cell as unknown, such as after the screen is cleared
+ */
+void ShadowClear()
+{
+    memset(shadowCells, 0, sizeof(shadowCells));
+}
+
+/*
+ * Returns the appearance of a view cell or SHADOW_UNKNOWN if it is not
+ * covered by the shadow
+ */
+uint8_t ShadowGet(const uint8_t x, const uint8_t y)
+{
+    if(y >= SHADOW_ROWS || x >= MAP_WIDTH)
+    {
+        return SHADOW_UNKNOWN;
+    }
+
+    uint8_t packed = shadowCells[y][x >> 1];
+    return (x & 1) ? (packed >> 4) : (packed & 0x0F);
+}
+
+/*
+ * Records the appearance of a view cell
+ */
+void ShadowSet(const uint8_t x, const uint8_t y, const uint8_t id)
+{
+    if(y >= SHADOW_ROWS || x >= MAP_WIDTH)
+    {
+        return;
+    }
+
+    uint8_t *packed = &shadowCells[y][x >> 1];
+
+    if(x & 1)
+    {
+        *packed = (*packed & 0x0F) | (id << 4);
+    }
+    else
+    {
+        *packed = (*packed & 0xF0) | (id & 0x0F);
+    }
+}
+
+/*
+ * Moves the shadow of a width by height area of the view the same way the
+ * terminal moved it when the view moved by dx, dy. Cells that came into
+ * view are unknown.
+ */
+void ShadowScroll(const int16_t dx, const int16_t dy, const uint8_t width,
+    const uint8_t height)
+{
+    uint8_t rows = (height < SHADOW_ROWS) ? height : SHADOW_ROWS;
+    uint8_t columns = (width < MAP_WIDTH) ? width : MAP_WIDTH;
+
+    if(dy > 0)
+    {
+        for(uint8_t y = 0; y < rows; y++)
+        {
+            if(y + dy < rows)
+            {
+                memcpy(shadowCells[y], shadowCells[y + dy], SHADOW_ROW_BYTES);
+            }
+            else
+            {
+                memset(shadowCells[y], 0, SHADOW_ROW_BYTES);
+            }
+        }
+    }
+    else if(dy < 0)
+    {
+        for(uint8_t y = rows; y-- > 0;)
+        {
+            if(y >= -dy)
+            {
+                memcpy(shadowCells[y], shadowCells[y + dy], SHADOW_ROW_BYTES);
+            }
+            else
+            {
+                memset(shadowCells[y], 0, SHADOW_ROW_BYTES);
+            }
+        }
+    }
+
+    for(uint8_t y = 0; y < rows && dx != 0; y++)
+    {
+        if(dx > 0)
+        {
+            for(uint8_t x = 0; x < columns; x++)
+            {
+                ShadowSet(x, y, (x + dx < columns)
+                    ? ShadowGet(x + dx, y) : SHADOW_UNKNOWN);
+            }
+        }
+        else
+        {
+            for(uint8_t x = columns; x-- > 0;)
+            {
+                ShadowSet(x, y, (x >= -dx)
+                    ? ShadowGet(x + dx, y) : SHADOW_UNKNOWN);
+            }
+        }
+    }
+}
+
+/*
+ * Forgets the cells outside of the top left width by height of the view, as
+ * the terminal no longer shows them after a resize
+ */
+void ShadowClip(const uint8_t width, const uint8_t height)
+{
+    for(uint8_t y = 0; y < SHADOW_ROWS; y++)
+    {
+        if(y >= height)
+        {
+            memset(shadowCells[y], 0, SHADOW_ROW_BYTES);
+            continue;
+        }
+
+        for(uint8_t x = width; x < MAP_WIDTH; x++)
+        {
+            ShadowSet(x, y, SHADOW_UNKNOWN);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Shadow of the map view
+ *
+ * Holds the appearance last sent to the terminal for each cell of the map
+ * view so that cells which would not change can be skipped. Appearances are
+ * 4-bit ids packed two to a byte. The shadow is an opt-in experiment that
+ * covers the first SHADOW_ROWS rows of the view, at SHADOW_ROW_BYTES of RAM
+ * a row. It is compiled out unless SHADOW_ROWS is defined, as a full shadow
+ * does not fit in the RAM of the AVR and one row is about all that fits
+ * beside 128 bots. Without it every cell queued is sent.
+ */
+
+#ifndef SHADOW_H
+#define SHADOW_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Cell.h"
+
+#define SHADOW_UNKNOWN 0
+#define SHADOW_IDS 16
+
+#ifdef SHADOW_ROWS
+
+#define SHADOW_ROW_BYTES ((MAP_WIDTH + 1) / 2)
+
+void ShadowClear();
+uint8_t ShadowGet(const uint8_t x, const uint8_t y);
+void ShadowSet(const uint8_t x, const uint8_t y, const uint8_t id);
+void ShadowScroll(const int16_t dx, const int16_t dy, const uint8_t width,
+    const uint8_t height);
+void ShadowClip(const uint8_t width, const uint8_t height);
+
+#else
+
+#define ShadowClear()
+#define ShadowGet(x, y) SHADOW_UNKNOWN
+#define ShadowSet(x, y, id)
+#define ShadowScroll(dx, dy, width, height)
+#define ShadowClip(width, height)
+
+#endif
+
+#endif
@@ -13,11 +13,222 @@ const char CS_MoveCursor[] PROGMEM = { 'H' };
 const char CS_HideCursor[] PROGMEM = { '?', '2', '5', 'l' };
 const char CS_ShowCursor[] PROGMEM = { '?', '2', '5', 'h' };
 const char CS_ClearScreen[] PROGMEM = { '2', 'J' };
+const char CS_EraseLine[] PROGMEM = { 'K' };
 const char CS_UseAlternateBuffer[] PROGMEM = { '?', '4', '7', 'h' };
 const char CS_SetXTermBgColor[] PROGMEM = { '4', '8', ';', '5', ';' };
 const char CS_SetXTermFgColor[] PROGMEM = { '3', '8', ';', '5', ';' };
+const char CS_EnableMargins[] PROGMEM = { '?', '6', '9', 'h' };
+const char CS_DisableMargins[] PROGMEM = { '?', '6', '9', 'l' };
+const char CS_ResetScrollRegion[] PROGMEM = { 'r' };
+const char CS_BeginUpdate[] PROGMEM = { '?', '2', '0', '2', '6', 'h' };
+const char CS_EndUpdate[] PROGMEM = { '?', '2', '0', '2', '6', 'l' };
+const char CS_ProbeTerminal[] PROGMEM = {
+    ' ', 0x1B, '[', 'b',
+    0x1B, '[', '6', 'n',
+    0x1B, '[', '?', '6', '9', '$', 'p',
+    0x1B, '[', '?', '2', '0', '2', '6', '$', 'p',
+    0x1B, '[', '>', 'c',
+    0x1B, '[', 'c'
+};
 const char CR_LF[] PROGMEM = { '\r', '\n' };
 
+/*
+ * Three digit decimal representations of 0 to 255 for formatting parameters
+ */
+const char terminalDecimals[] PROGMEM =
+    "000001002003004005006007008009010011012013014015"
+    "016017018019020021022023024025026027028029030031"
+    "032033034035036037038039040041042043044045046047"
+    "048049050051052053054055056057058059060061062063"
+    "064065066067068069070071072073074075076077078079"
+    "080081082083084085086087088089090091092093094095"
+    "096097098099100101102103104105106107108109110111"
+    "112113114115116117118119120121122123124125126127"
+    "128129130131132133134135136137138139140141142143"
+    "144145146147148149150151152153154155156157158159"
+    "160161162163164165166167168169170171172173174175"
+    "176177178179180181182183184185186187188189190191"
+    "192193194195196197198199200201202203204205206207"
+    "208209210211212213214215216217218219220221222223"
+    "224225226227228229230231232233234235236237238239"
+    "240241242243244245246247248249250251252253254255";
+
+/*
+ * The colors last sent to the terminal
+ */
+uint8_t terminalFg = TERM_COLOR_NONE;
+uint8_t terminalBg = TERM_COLOR_NONE;
+
+/*
+ * Features the terminal is known to support
+ */
+uint8_t terminalCaps = TERM_CAPS_DEFAULT;
+
+/*
+ * Set while a synchronized update is open
+ */
+bool terminalUpdating = FALSE;
+
+/*
+ * Set to send the 16 basic colors even if the terminal has 256
+ */
+bool terminalBasicColors = FALSE;
+
+/*
+ * Features found so far while the terminal is being probed
+ */
+bool terminalProbing = FALSE;
+uint8_t terminalProbeCaps;
+
+/*
+ * Steps between requests for the size of the terminal and steps left until
+ * the next one
+ */
+uint8_t terminalPollInterval = 1;
+uint8_t terminalPollCountdown = 0;
+
+/*
+ * The size of the terminal and the state of its cursor as last sent. The
+ * cursor position is not known after a line wrap or a change of size.
+ */
+Size_t terminalSize = { .Width = TERMINAL_DEF_WIDTH,
+    .Height = TERMINAL_DEF_HEIGHT };
+Point_t terminalCursor;
+bool terminalCursorValid = FALSE;
+uint8_t terminalCursorVisibility = TERM_CURSOR_UNKNOWN;
+
+/*
+ * Sets the features the terminal is known to support
+ */
+void TerminalSetCaps(const uint8_t caps)
+{
+    terminalCaps = caps;
+}
+
+/*
+ * Returns TRUE if the terminal supports all of the given features
+ */
+bool TerminalHasCaps(const uint8_t caps)
+{
+    return (terminalCaps & caps) == caps;
+}
+
+/*
+ * Chooses the 16 basic colors, which take fewer bytes, over 256 colors
+ */
+void TerminalUseBasicColors(const bool basic)
+{
+    terminalBasicColors = basic;
+}
+
+/*
+ * Returns TRUE if colors are sent from the 256 color palette
+ */
+bool TerminalUses256Colors()
+{
+    return TerminalHasCaps(TERM_CAP_256_COLORS) && !terminalBasicColors;
+}
+
+/*
+ * Asks the terminal which features it supports. A space is repeated with
+ * REP and the cursor position requested to see if it moved, DECRQM asks for
+ * the modes and the device attributes give the terminal class. The primary
+ * attributes are asked for last as every terminal answers them, so their
+ * reply ends the probe. Replies are passed back by the input parser.
+ */
+void TerminalProbe()
+{
+    terminalProbing = TRUE;
+    terminalProbeCaps = 0;
+
+    TerminalCursorHome();
+    UartPrintP(CS_ProbeTerminal, sizeof(CS_ProbeTerminal));
+    terminalCursorValid = FALSE;
+}
+
+/*
+ * Returns TRUE until the terminal has answered the probe
+ */
+bool TerminalProbing()
+{
+    return terminalProbing;
+}
+
+/*
+ * Stops waiting for the probe. Capabilities are left as they are if the
+ * terminal did not answer.
+ */
+void TerminalEndProbe()
+{
+    terminalProbing = FALSE;
+}
+
+/*
+ * Handles a cursor position report. The space sent at the first column was
+ * repeated if the cursor is at the third.
+ */
+void TerminalProbeCursor(const uint16_t column)
+{
+    if(terminalProbing && column == 3)
+    {
+        terminalProbeCaps |= TERM_CAP_REPEAT;
+    }
+}
+
+/*
+ * Handles a DECRQM report of whether a mode is set
+ */
+void TerminalProbeMode(const uint16_t mode, const uint16_t state)
+{
+    // States 0 and 4 are unknown and permanently reset
+    if(!terminalProbing || state == 0 || state == 4)
+    {
+        return;
+    }
+
+    if(mode == TERM_MODE_MARGINS)
+    {
+        terminalProbeCaps |= TERM_CAP_MARGINS;
+    }
+    else if(mode == TERM_MODE_SYNC)
+    {
+        terminalProbeCaps |= TERM_CAP_SYNC;
+    }
+}
+
+/*
+ * Handles the primary ('?') or secondary ('>') device attributes. Terminals
+ * that answer the secondary attributes or claim a VT220 or later have 256
+ * colors, and those from the VT420 on can scroll a region. The primary
+ * attributes complete the probe.
+ */
+void TerminalProbeAttributes(const char kind, const uint16_t level)
+{
+    if(!terminalProbing)
+    {
+        return;
+    }
+
+    if(kind == '>')
+    {
+        terminalProbeCaps |= TERM_CAP_256_COLORS | TERM_CAP_SCROLL;
+        return;
+    }
+
+    if(level >= 62)
+    {
+        terminalProbeCaps |= TERM_CAP_256_COLORS;
+    }
+
+    if(level >= 64)
+    {
+        terminalProbeCaps |= TERM_CAP_SCROLL;
+    }
+
+    TerminalSetCaps(terminalProbeCaps);
+    terminalProbing = FALSE;
+}
+
 /*
  * Requests the size of the terminal window
  */
@@ -27,6 +238,51 @@ void TerminalRequestSize()
     UartPrintP(CS_GetWindowSize, 3);
 }
 
+/*
+ * Called once per game step to request the size of the terminal when it is
+ * due. A request that does not fit in the transmit buffer is sent on a later
+ * step.
+ */
+void TerminalPollSize()
+{
+    if(terminalPollCountdown > 0)
+    {
+        terminalPollCountdown--;
+        return;
+    }
+
+    if(UartTransmitSpace() < TERMINAL_SIZE_REQUEST_LENGTH)
+    {
+        return;
+    }
+
+    TerminalRequestSize();
+    terminalPollCountdown = terminalPollInterval - 1;
+
+    if(terminalPollInterval < TERMINAL_POLL_MAX_STEPS)
+    {
+        terminalPollInterval <<= 1;
+    }
+}
+
+/*
+ * Polls the size of the terminal often again after it was reported changed
+ */
+void TerminalSizeChanged()
+{
+    terminalPollInterval = 1;
+    terminalPollCountdown = 0;
+}
+
+/*
+ * Sets the size of the terminal. The cursor position is no longer known.
+ */
+void TerminalSetSize(const Size_t *size)
+{
+    terminalSize = *size;
+    terminalCursorValid = FALSE;
+}
+
 /*
  * Moves the terminal cursor to the home position (1, 1)
  */
@@ -34,6 +290,7 @@ void TerminalCursorHome()
 {
     UartPrintP(CS_CCI, 2);
     UartPrintP(CS_MoveCursor, 1);
+    TerminalCursorMoved(0, 0);
 }
 
 /*
@@ -41,25 +298,200 @@ void TerminalCursorHome()
  */
 void TerminalCursorMove(const Point_t *p)
 {
-    UartPrintP(CS_CCI, 2);
-    
-    // Buffer size based on 3 characters per parameter plus the delimeters
-    char buf[9];
-    sprintf(buf, "%u;%uH", p->Y + 1, p->X + 1);
-    UartPrint(buf, strlen(buf));
+    TerminalCursorMoveXY(p->X, p->Y);
 }
 
 /*
- * Moves the terminal to x, y
+ * Moves the terminal to x, y. When the cursor position is known the
+ * shortest of the absolute and relative moves is sent, and nothing is sent
+ * if the cursor is already there.
  */
 void TerminalCursorMoveXY(const uint8_t x, const uint8_t y)
 {
-    UartPrintP(CS_CCI, 2);
-    
-    // Buffer size based on 3 characters per parameter plus the delimeters
-    char buf[9];
-    sprintf(buf, "%u;%uH", y + 1, x + 1);
-    UartPrint(buf, strlen(buf));
+    if(terminalCursorValid)
+    {
+        if(x == terminalCursor.X && y == terminalCursor.Y)
+        {
+            return;
+        }
+
+        uint8_t absolute = TerminalParamLength(y + 1)
+            + TerminalParamLength(x + 1) + 4;
+
+        if(TerminalRelativeMoveLength(x, y) < absolute)
+        {
+            TerminalRelativeMove(x, y);
+            return;
+        }
+    }
+
+    TerminalSendParams(y + 1, x + 1, 'H');
+    TerminalCursorMoved(x, y);
+}
+
+/*
+ * Returns the number of bytes needed to move the cursor from its known
+ * position to x, y with relative moves
+ */
+uint8_t TerminalRelativeMoveLength(const uint8_t x, const uint8_t y)
+{
+    uint8_t length = 0;
+
+    if(y != terminalCursor.Y)
+    {
+        length += TerminalMoveLength((y > terminalCursor.Y) ? y - terminalCursor.Y
+            : terminalCursor.Y - y);
+    }
+
+    if(x == 0 && terminalCursor.X != 0)
+    {
+        length += 1;
+    }
+    else if(x < terminalCursor.X)
+    {
+        uint8_t count = terminalCursor.X - x;
+        uint8_t back = TerminalMoveLength(count);
+        length += (count < back) ? count : back;
+    }
+    else if(x > terminalCursor.X)
+    {
+        length += TerminalMoveLength(x - terminalCursor.X);
+    }
+
+    return length;
+}
+
+/*
+ * Moves the cursor from its known position to x, y with relative moves.
+ * Short moves left use backspaces and moves to the first column use a
+ * carriage return.
+ */
+void TerminalRelativeMove(const uint8_t x, const uint8_t y)
+{
+    if(y < terminalCursor.Y)
+    {
+        TerminalSendMove(terminalCursor.Y - y, 'A');
+    }
+    else if(y > terminalCursor.Y)
+    {
+        TerminalSendMove(y - terminalCursor.Y, 'B');
+    }
+
+    if(x == 0 && terminalCursor.X != 0)
+    {
+        UartTransmitByte('\r');
+    }
+    else if(x < terminalCursor.X)
+    {
+        uint8_t count = terminalCursor.X - x;
+
+        if(count < TerminalMoveLength(count))
+        {
+            for(uint8_t i = 0; i < count; i++)
+            {
+                UartTransmitByte('\b');
+            }
+        }
+        else
+        {
+            TerminalSendMove(count, 'D');
+        }
+    }
+    else if(x > terminalCursor.X)
+    {
+        TerminalSendMove(x - terminalCursor.X, 'C');
+    }
+
+    TerminalCursorMoved(x, y);
+}
+
+/*
+ * Records a new known position of the cursor
+ */
+void TerminalCursorMoved(const uint8_t x, const uint8_t y)
+{
+    terminalCursor.X = x;
+    terminalCursor.Y = y;
+    terminalCursorValid = TRUE;
+}
+
+/*
+ * Records that the cursor advanced by count columns after printing. The
+ * position is unknown once the cursor reaches the right edge as the
+ * terminal may be waiting to wrap.
+ */
+void TerminalCursorAdvance(const uint8_t count)
+{
+    if(terminalCursorValid)
+    {
+        if(count >= terminalSize.Width - terminalCursor.X)
+        {
+            terminalCursorValid = FALSE;
+        }
+        else
+        {
+            terminalCursor.X += count;
+        }
+    }
+}
+
+/*
+ * Returns the number of characters in a numeric parameter
+ */
+uint8_t TerminalParamLength(const uint8_t param)
+{
+    return (param < 10) ? 1 : (param < 100) ? 2 : 3;
+}
+
+/*
+ * Returns the number of bytes in a cursor movement sequence
+ */
+uint8_t TerminalMoveLength(const uint8_t count)
+{
+    return (count == 1) ? 3 : TerminalParamLength(count) + 3;
+}
+
+/*
+ * Sends a cursor movement sequence. The count is left out when it is one.
+ */
+void TerminalSendMove(const uint8_t count, const char command)
+{
+    if(count == 1)
+    {
+        UartPrintP(CS_CCI, 2);
+        UartTransmitByte(command);
+    }
+    else
+    {
+        TerminalSendParam(count, command);
+    }
+}
+
+/*
+ * Prints a character at the cursor
+ */
+void TerminalPutChar(const char c)
+{
+    UartTransmitByte(c);
+    TerminalCursorAdvance(1);
+}
+
+/*
+ * Prints a string at the cursor
+ */
+void TerminalPrint(const char *s, const uint8_t length)
+{
+    UartPrint(s, length);
+    TerminalCursorAdvance(length);
+}
+
+/*
+ * Prints a string stored in program memory at the cursor
+ */
+void TerminalPrintP(const char *s, const uint8_t length)
+{
+    UartPrintP(s, length);
+    TerminalCursorAdvance(length);
 }
 
 /*
@@ -67,8 +499,12 @@ void TerminalCursorMoveXY(const uint8_t x, const uint8_t y)
  */
 void TerminalCursorHide()
 {
-    UartPrintP(CS_CCI, 2);
-    UartPrintP(CS_HideCursor, 4);
+    if(terminalCursorVisibility != TERM_CURSOR_HIDDEN)
+    {
+        UartPrintP(CS_CCI, 2);
+        UartPrintP(CS_HideCursor, 4);
+        terminalCursorVisibility = TERM_CURSOR_HIDDEN;
+    }
 }
 
 /*
@@ -76,8 +512,12 @@ void TerminalCursorHide()
  */
 void TerminalCursorShow()
 {
-    UartPrintP(CS_CCI, 2);
-    UartPrintP(CS_ShowCursor, 4);
+    if(terminalCursorVisibility != TERM_CURSOR_VISIBLE)
+    {
+        UartPrintP(CS_CCI, 2);
+        UartPrintP(CS_ShowCursor, 4);
+        terminalCursorVisibility = TERM_CURSOR_VISIBLE;
+    }
 }
 
 /*
@@ -89,6 +529,44 @@ void TerminalUseAlternateBuffer()
     UartPrintP(CS_UseAlternateBuffer, 4);
 }
 
+/*
+ * Asks the terminal to hold off drawing until the update is ended so that a
+ * frame appears at once. Does nothing if synchronized output is unsupported
+ * or an update is already open.
+ */
+void TerminalBeginUpdate()
+{
+    if(TerminalHasCaps(TERM_CAP_SYNC) && !terminalUpdating)
+    {
+        UartPrintP(CS_CCI, 2);
+        UartPrintP(CS_BeginUpdate, 6);
+        terminalUpdating = TRUE;
+    }
+}
+
+/*
+ * Returns the number of bytes TerminalBeginUpdate would send
+ */
+uint8_t TerminalBeginUpdateLength()
+{
+    return (TerminalHasCaps(TERM_CAP_SYNC) && !terminalUpdating)
+        ? TERM_UPDATE_LENGTH : 0;
+}
+
+/*
+ * Lets the terminal draw everything sent since the update began. Does
+ * nothing if no update is open.
+ */
+void TerminalEndUpdate()
+{
+    if(terminalUpdating)
+    {
+        UartPrintP(CS_CCI, 2);
+        UartPrintP(CS_EndUpdate, 6);
+        terminalUpdating = FALSE;
+    }
+}
+
 /*
  * Clears the terminal window
  */
@@ -98,23 +576,27 @@ void TerminalClearScreen()
     UartPrintP(CS_ClearScreen, 2);
 }
 
+/*
+ * Erases from the cursor to the end of the line in the background color
+ */
+void TerminalEraseLine()
+{
+    UartPrintP(CS_CCI, 2);
+    UartPrintP(CS_EraseLine, 1);
+}
+
 /*
  * Changes the foreground color of the terminal
  */
 void TerminalSetFgColor(TermColor_t color)
 {
-    static TermColor_t prevColor = 0;
-    
-    if(color != prevColor)
+    if(color != terminalFg)
     {
         UartPrintP(CS_CCI, 2);
-        UartPrintP(CS_SetXTermFgColor, 5);
+        TerminalSendColor(FALSE, color);
+        UartTransmitByte('m');
         
-        char buf[5];
-        sprintf(buf, "%um", color);
-        UartPrint(buf, strlen(buf));
-        
-        prevColor = color;
+        terminalFg = color;
     }
 }
 
@@ -123,26 +605,324 @@ void TerminalSetFgColor(TermColor_t color)
  */
 void TerminalSetBgColor(TermColor_t color)
 {
-    static TermColor_t prevColor = 0;
-
-    if(color != prevColor)
+    if(color != terminalBg)
     {
         UartPrintP(CS_CCI, 2);
-        UartPrintP(CS_SetXTermBgColor, 5);
-        
-        char buf[5];
-        sprintf(buf, "%um", color);
-        UartPrint(buf, strlen(buf));
+        TerminalSendColor(TRUE, color);
+        UartTransmitByte('m');
         
-        prevColor = color;
+        terminalBg = color;
+    }
+}
+
+/*
+ * Changes both colors of the terminal, using one sequence if both differ
+ */
+void TerminalSetColors(TermColor_t fg, TermColor_t bg)
+{
+    if(fg != terminalFg && bg != terminalBg)
+    {
+        UartPrintP(CS_CCI, 2);
+        TerminalSendColor(FALSE, fg);
+        UartTransmitByte(';');
+        TerminalSendColor(TRUE, bg);
+        UartTransmitByte('m');
+
+        terminalFg = fg;
+        terminalBg = bg;
+    }
+    else
+    {
+        TerminalSetFgColor(fg);
+        TerminalSetBgColor(bg);
+    }
+}
+
+/*
+ * Changes the colors of the terminal to a style stored in program memory.
+ * The pre-encoded sequence is sent when both colors change and 256 colors
+ * are in use.
+ */
+void TerminalSetStyleP(const TermStyle_t *style)
+{
+    TermColor_t fg = pgm_read_byte(&(style->Fg));
+    TermColor_t bg = pgm_read_byte(&(style->Bg));
+
+    if(fg != terminalFg && bg != terminalBg
+        && TerminalUses256Colors())
+    {
+        UartPrintP(style->Sequence, pgm_read_byte(&(style->Length)));
+
+        terminalFg = fg;
+        terminalBg = bg;
+    }
+    else
+    {
+        TerminalSetColors(fg, bg);
+    }
+}
+
+/*
+ * Sends the SGR parameters that select a foreground or background color.
+ * Otherwise the nearest of the 16 basic colors is sent.
+ */
+void TerminalSendColor(const bool background, const TermColor_t color)
+{
+    if(TerminalUses256Colors())
+    {
+        UartPrintP(background ? CS_SetXTermBgColor : CS_SetXTermFgColor, 5);
+        TerminalSendDecimal(color);
+        return;
     }
+
+    uint8_t basic = TerminalBasicColor(color);
+    uint8_t base = background ? 40 : 30;
+
+    // Bright colors are 90 to 97 and 100 to 107
+    TerminalSendDecimal((basic < 8) ? base + basic : base + 60 + basic - 8);
+}
+
+/*
+ * Returns the nearest of the 16 basic colors to an xterm 256 color. Cube
+ * channels of 0xAF and above are on and a channel at 0xFF makes the color
+ * bright. Greys step from black to bright white.
+ */
+uint8_t TerminalBasicColor(const TermColor_t color)
+{
+    if(color < 16)
+    {
+        return color;
+    }
+
+    if(color >= 232)
+    {
+        uint8_t grey = color - 232;
+        return (grey < 6) ? 0 : (grey < 13) ? 8 : (grey < 20) ? 7 : 15;
+    }
+
+    uint8_t r = (color - 16) / 36;
+    uint8_t g = ((color - 16) / 6) % 6;
+    uint8_t b = (color - 16) % 6;
+    uint8_t max = (r > g) ? r : g;
+    max = (b > max) ? b : max;
+
+    uint8_t basic = ((r >= 3) ? 1 : 0) | ((g >= 3) ? 2 : 0)
+        | ((b >= 3) ? 4 : 0);
+
+    if(basic == 0)
+    {
+        return (max >= 2) ? 8 : 0;
+    }
+
+    return (max == 5) ? basic + 8 : basic;
+}
+
+/*
+ * Sends a number as decimal digits without leading zeros
+ */
+void TerminalSendDecimal(const uint8_t value)
+{
+    uint8_t length = TerminalParamLength(value);
+    UartPrintP(&terminalDecimals[(value * 3) + 3 - length], length);
+}
+
+/*
+ * Sends a control sequence with a single numeric parameter
+ */
+void TerminalSendParam(const uint8_t param, const char command)
+{
+    UartPrintP(CS_CCI, 2);
+    TerminalSendDecimal(param);
+    UartTransmitByte(command);
+}
+
+/*
+ * Sends a control sequence with two numeric parameters
+ */
+void TerminalSendParams(const uint8_t first, const uint8_t second,
+    const char command)
+{
+    UartPrintP(CS_CCI, 2);
+    TerminalSendDecimal(first);
+    UartTransmitByte(';');
+    TerminalSendDecimal(second);
+    UartTransmitByte(command);
 }
 
 void TerminalInsertSpaces(uint8_t count)
+{
+    TerminalSendParam(count, '@');
+}
+
+/*
+ * Prints a character count times. Longer runs are sent as the character
+ * followed by REP when the terminal has it and that is shorter than sending
+ * them literally.
+ */
+void TerminalRepeatChar(const char c, const uint8_t count)
+{
+    if(count == 0)
+    {
+        return;
+    }
+
+    UartTransmitByte(c);
+    TerminalCursorAdvance(count);
+
+    uint8_t repeats = count - 1;
+    uint8_t length = (repeats < 10) ? 4 : (repeats < 100) ? 5 : 6;
+
+    if(repeats > length && TerminalHasCaps(TERM_CAP_REPEAT))
+    {
+        TerminalSendParam(repeats, 'b');
+    }
+    else
+    {
+        for(uint8_t i = 0; i < repeats; i++)
+        {
+            UartTransmitByte(c);
+        }
+    }
+}
+
+/*
+ * Erases count characters from the cursor with the background color. The
+ * cursor does not move.
+ */
+void TerminalEraseChars(const uint8_t count)
+{
+    TerminalSendParam(count, 'X');
+}
+
+/*
+ * Blanks count characters from the cursor with the background color and
+ * moves the cursor past them. They are printed as spaces, or erased and
+ * moved over when that is shorter.
+ */
+void TerminalBlankChars(const uint8_t count)
+{
+    if(count == 0)
+    {
+        return;
+    }
+
+    // The length of the spaces as TerminalRepeatChar sends them
+    uint8_t repeats = count - 1;
+    uint8_t repeatLength = TerminalParamLength(repeats) + 3;
+    uint8_t printLength = (repeats > repeatLength
+        && TerminalHasCaps(TERM_CAP_REPEAT)) ? repeatLength + 1 : count;
+    uint8_t eraseLength = TerminalParamLength(count) + 3
+        + TerminalMoveLength(count);
+
+    if(printLength <= eraseLength)
+    {
+        TerminalRepeatChar(' ', count);
+    }
+    else
+    {
+        TerminalEraseChars(count);
+        TerminalCursorForward(count);
+    }
+}
+
+/*
+ * Moves the cursor forward by count columns
+ */
+void TerminalCursorForward(const uint8_t count)
+{
+    TerminalSendMove(count, 'C');
+
+    // The cursor stops at the right edge rather than wrapping
+    if(terminalCursorValid)
+    {
+        terminalCursor.X = (count >= terminalSize.Width - terminalCursor.X)
+            ? terminalSize.Width - 1 : terminalCursor.X + count;
+    }
+}
+
+/*
+ * Deletes count characters at the cursor, shifting the rest of the line left
+ */
+void TerminalDeleteChars(const uint8_t count)
+{
+    TerminalSendParam(count, 'P');
+}
+
+/*
+ * Limits scrolling to the rows from top to bottom inclusive. The cursor is
+ * moved to the home position.
+ */
+void TerminalSetScrollRegion(const uint8_t top, const uint8_t bottom)
+{
+    TerminalSendParams(top + 1, bottom + 1, 'r');
+    TerminalCursorMoved(0, 0);
+}
+
+/*
+ * Restores scrolling to the whole window. The cursor is moved to the home
+ * position.
+ */
+void TerminalResetScrollRegion()
+{
+    UartPrintP(CS_CCI, 2);
+    UartPrintP(CS_ResetScrollRegion, 1);
+    TerminalCursorMoved(0, 0);
+}
+
+/*
+ * Scrolls the scroll region up by count rows
+ */
+void TerminalScrollUp(const uint8_t count)
+{
+    TerminalSendParam(count, 'S');
+}
+
+/*
+ * Scrolls the scroll region down by count rows
+ */
+void TerminalScrollDown(const uint8_t count)
+{
+    TerminalSendParam(count, 'T');
+}
+
+/*
+ * Enables or disables left and right margins (DECLRMM). Disabling them also
+ * resets them to the whole window.
+ */
+void TerminalEnableMargins(const bool enable)
+{
+    UartPrintP(CS_CCI, 2);
+    UartPrintP(enable ? CS_EnableMargins : CS_DisableMargins, 4);
+}
+
+/*
+ * Limits scrolling to the columns from left to right inclusive. The cursor
+ * is moved to the home position.
+ */
+void TerminalSetMargins(const uint8_t left, const uint8_t right)
+{
+    TerminalSendParams(left + 1, right + 1, 's');
+    TerminalCursorMoved(0, 0);
+}
+
+/*
+ * Inserts count blank columns at the cursor within the margins (DECIC)
+ */
+void TerminalInsertColumns(const uint8_t count)
+{
+    UartPrintP(CS_CCI, 2);
+    TerminalSendDecimal(count);
+    UartTransmitByte('\'');
+    UartTransmitByte('}');
+}
+
+/*
+ * Deletes count columns at the cursor within the margins (DECDC)
+ */
+void TerminalDeleteColumns(const uint8_t count)
 {
     UartPrintP(CS_CCI, 2);
-    
-    char buf[5];
-    sprintf(buf, "%u@", count);
-    UartPrint(buf, strlen(buf));
+    TerminalSendDecimal(count);
+    UartTransmitByte('\'');
+    UartTransmitByte('~');
 }
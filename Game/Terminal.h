@@ -10,6 +10,8 @@
 
 #include "Uart.h"
 #include "Point.h"
+#include "Size.h"
+#include "Bool.h"
 
 #define TERMINAL_DEF_WIDTH 80
 #define TERMINAL_DEF_HEIGHT 24
@@ -33,24 +35,148 @@ typedef enum TermColor_t {
     TermColor_606060 = 241,
 } TermColor_t;
 
+/*
+ * A color that has not been sent to the terminal
+ */
+#define TERM_COLOR_NONE 0xFF
+
+/*
+ * Foreground and background colors with the sequence that sets both, for
+ * styles that are encoded ahead of time and stored in program memory
+ */
+#define TERM_STYLE_LENGTH 20
+
+typedef struct TermStyle_t {
+    TermColor_t Fg;
+    TermColor_t Bg;
+    uint8_t Length;
+    char Sequence[TERM_STYLE_LENGTH];
+} TermStyle_t;
+
+#define TERM_STYLE(fg, bg, sequence) \
+    { (fg), (bg), sizeof(sequence) - 1, sequence }
+
+/*
+ * Optional terminal features. Each is only enabled once the terminal's reply
+ * to the probe shows it is supported. A terminal that does not answer is
+ * treated as a VT102 such as minicom, with none of them.
+ */
+#define TERM_CAP_MARGINS 0x01
+#define TERM_CAP_SYNC 0x02
+#define TERM_CAP_REPEAT 0x04
+#define TERM_CAP_SCROLL 0x08
+#define TERM_CAP_256_COLORS 0x10
+
+#define TERM_CAPS_DEFAULT 0
+
+/*
+ * How long to wait for the terminal to answer the probe
+ */
+#define TERMINAL_PROBE_MS 250
+
+/*
+ * Modes reported by DECRQM as set or reset, and so supported
+ */
+#define TERM_MODE_MARGINS 69
+#define TERM_MODE_SYNC 2026
+
+/*
+ * The longest absolute cursor move, with three digits for each coordinate
+ */
+#define TERM_MOVE_LENGTH 10
+
+/*
+ * The length of the sequences that begin and end a synchronized update
+ */
+#define TERM_UPDATE_LENGTH 8
+
+/*
+ * The size of the terminal is requested every step after it changes and at
+ * startup. The interval doubles each time it is requested, up to a limit,
+ * while the size stays the same.
+ */
+#define TERMINAL_POLL_MAX_STEPS 64
+#define TERMINAL_SIZE_REQUEST_LENGTH 5
+
+/*
+ * Visibility of the terminal cursor
+ */
+#define TERM_CURSOR_UNKNOWN 0
+#define TERM_CURSOR_HIDDEN 1
+#define TERM_CURSOR_VISIBLE 2
+
 /*
  * Terminal Functions
  */
+void TerminalSetCaps(const uint8_t caps);
+bool TerminalHasCaps(const uint8_t caps);
+void TerminalUseBasicColors(const bool basic);
+bool TerminalUses256Colors();
+
+void TerminalProbe();
+bool TerminalProbing();
+void TerminalEndProbe();
+void TerminalProbeCursor(const uint16_t column);
+void TerminalProbeMode(const uint16_t mode, const uint16_t state);
+void TerminalProbeAttributes(const char kind, const uint16_t level);
+
 void TerminalRequestSize();
+void TerminalPollSize();
+void TerminalSizeChanged();
+
+void TerminalSetSize(const Size_t *size);
 
 void TerminalCursorHome();
 void TerminalCursorMove(const Point_t *p);
 void TerminalCursorMoveXY(const uint8_t x, const uint8_t y);
+uint8_t TerminalRelativeMoveLength(const uint8_t x, const uint8_t y);
+void TerminalRelativeMove(const uint8_t x, const uint8_t y);
+void TerminalCursorMoved(const uint8_t x, const uint8_t y);
+void TerminalCursorAdvance(const uint8_t count);
+uint8_t TerminalParamLength(const uint8_t param);
+uint8_t TerminalMoveLength(const uint8_t count);
+void TerminalSendMove(const uint8_t count, const char command);
 void TerminalCursorHide();
 void TerminalCursorShow();
+void TerminalCursorForward(const uint8_t count);
+
+void TerminalPutChar(const char c);
+void TerminalPrint(const char *s, const uint8_t length);
+void TerminalPrintP(const char *s, const uint8_t length);
 
 void TerminalUseAlternateBuffer();
+void TerminalBeginUpdate();
+uint8_t TerminalBeginUpdateLength();
+void TerminalEndUpdate();
 void TerminalClearScreen();
+void TerminalEraseLine();
 
 void TerminalSetFgColor(TermColor_t color);
 void TerminalSetBgColor(TermColor_t color);
+void TerminalSetColors(TermColor_t fg, TermColor_t bg);
+void TerminalSetStyleP(const TermStyle_t *style);
+void TerminalSendColor(const bool background, const TermColor_t color);
+uint8_t TerminalBasicColor(const TermColor_t color);
 
+void TerminalSendDecimal(const uint8_t value);
+
+void TerminalSendParam(const uint8_t param, const char command);
+void TerminalSendParams(const uint8_t first, const uint8_t second,
+    const char command);
 void TerminalInsertSpaces(uint8_t count);
+void TerminalRepeatChar(const char c, const uint8_t count);
+void TerminalEraseChars(const uint8_t count);
+void TerminalBlankChars(const uint8_t count);
+void TerminalDeleteChars(const uint8_t count);
+
+void TerminalSetScrollRegion(const uint8_t top, const uint8_t bottom);
+void TerminalResetScrollRegion();
+void TerminalScrollUp(const uint8_t count);
+void TerminalScrollDown(const uint8_t count);
+void TerminalEnableMargins(const bool enable);
+void TerminalSetMargins(const uint8_t left, const uint8_t right);
+void TerminalInsertColumns(const uint8_t count);
+void TerminalDeleteColumns(const uint8_t count);
 
 
 
@@ -0,0 +1,122 @@
+/*
+ * Timing Wheel Implementation
+ */
+
+#include "TimingWheel.h"
+
+/*
+ * Clears all slots of the wheel and attaches the per-entity storage
+ */
+void TimingWheelInit(TimingWheel_t *wheel, uint8_t *next, uint8_t *due)
+{
+    wheel->Now = 0;
+    wheel->Next = next;
+    wheel->Due = due;
+
+    for(uint8_t i = 0; i < WHEEL_SLOTS; i++)
+    {
+        wheel->Near[i] = WHEEL_NONE;
+        wheel->Far[i] = WHEEL_NONE;
+    }
+}
+
+/*
+ * Returns the near slot that an entity on the far wheel is due in
+ */
+uint8_t TimingWheelDueSlot(TimingWheel_t *wheel, uint8_t id)
+{
+    uint8_t due = wheel->Due[id / 2];
+    return (id & 1) ? (due >> 4) : (due & 0x0F);
+}
+
+/*
+ * Stores the near slot that an entity on the far wheel is due in
+ */
+void TimingWheelSetDueSlot(TimingWheel_t *wheel, uint8_t id, uint8_t slot)
+{
+    uint8_t *due = &wheel->Due[id / 2];
+    *due = (id & 1) ? ((*due & 0x0F) | (slot << 4)) : ((*due & 0xF0) | slot);
+}
+
+/*
+ * Places an entity into the slot for its due tick. Entities due in the
+ * current run of slots go onto the near wheel, the rest onto the far wheel
+ * with the near slot they will cascade into.
+ */
+void TimingWheelInsert(TimingWheel_t *wheel, uint8_t id, uint8_t due)
+{
+    uint8_t *slot;
+
+    if(((due ^ wheel->Now) & ~(WHEEL_SLOTS - 1)) == 0)
+    {
+        slot = &wheel->Near[due & (WHEEL_SLOTS - 1)];
+    }
+    else
+    {
+        TimingWheelSetDueSlot(wheel, id, due & (WHEEL_SLOTS - 1));
+        slot = &wheel->Far[(due / WHEEL_SLOTS) & (WHEEL_SLOTS - 1)];
+    }
+
+    wheel->Next[id] = *slot;
+    *slot = id;
+}
+
+/*
+ * Schedules an entity to be popped after a number of ticks. The delay is
+ * clamped to the range that the wheel can represent.
+ */
+void TimingWheelSchedule(TimingWheel_t *wheel, uint8_t id, uint8_t delay)
+{
+    if(delay == 0)
+    {
+        delay = 1;
+    }
+    else if(delay > WHEEL_MAX_DELAY)
+    {
+        delay = WHEEL_MAX_DELAY;
+    }
+
+    TimingWheelInsert(wheel, id, wheel->Now + delay);
+}
+
+/*
+ * Advances the wheel by one tick, cascading a far slot into the near wheel
+ * when a new run of slots begins.
+ */
+void TimingWheelTick(TimingWheel_t *wheel)
+{
+    wheel->Now++;
+
+    if((wheel->Now & (WHEEL_SLOTS - 1)) == 0)
+    {
+        uint8_t *slot = &wheel->Far[(wheel->Now / WHEEL_SLOTS)
+            & (WHEEL_SLOTS - 1)];
+        uint8_t id = *slot;
+        *slot = WHEEL_NONE;
+
+        while(id != WHEEL_NONE)
+        {
+            uint8_t next = wheel->Next[id];
+            TimingWheelInsert(wheel, id, (wheel->Now & ~(WHEEL_SLOTS - 1))
+                | TimingWheelDueSlot(wheel, id));
+            id = next;
+        }
+    }
+}
+
+/*
+ * Removes and returns an entity that is due on the current tick or
+ * WHEEL_NONE if there are none left.
+ */
+uint8_t TimingWheelPop(TimingWheel_t *wheel)
+{
+    uint8_t *slot = &wheel->Near[wheel->Now & (WHEEL_SLOTS - 1)];
+    uint8_t id = *slot;
+
+    if(id != WHEEL_NONE)
+    {
+        *slot = wheel->Next[id];
+    }
+
+    return id;
+}
@@ -0,0 +1,45 @@
+/*
+ * A two level hierarchical timing wheel.
+ *
+ * Entities are identified by a byte and are linked into the slot lists using
+ * an array of next indices supplied by the owner. The near wheel holds the
+ * entities that are due within the current run of WHEEL_SLOTS ticks and the
+ * far wheel holds one slot per run of WHEEL_SLOTS ticks. Far slots are
+ * cascaded into the near wheel as the current tick reaches them.
+ *
+ * The owner also supplies the due ticks, packed two entities to a byte. Only
+ * the near slot is kept, as the far slot an entity waits in gives the rest of
+ * its due tick, so a nibble is enough for the 16 slots.
+ */
+
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <stdint.h>
+
+#define WHEEL_SLOTS 16
+#define WHEEL_MAX_DELAY ((WHEEL_SLOTS - 1) * WHEEL_SLOTS)
+#define WHEEL_NONE 0xFF
+#define WHEEL_DUE_SIZE(count) (((count) + 1) / 2)
+
+/* Timing Wheel Data Structure ************************************************/
+
+typedef struct TimingWheel_t {
+    uint8_t Now;
+    uint8_t Near[WHEEL_SLOTS];
+    uint8_t Far[WHEEL_SLOTS];
+    uint8_t *Next;
+    uint8_t *Due;
+} TimingWheel_t;
+
+/* Functions ******************************************************************/
+
+void TimingWheelInit(TimingWheel_t *wheel, uint8_t *next, uint8_t *due);
+uint8_t TimingWheelDueSlot(TimingWheel_t *wheel, uint8_t id);
+void TimingWheelSetDueSlot(TimingWheel_t *wheel, uint8_t id, uint8_t slot);
+void TimingWheelInsert(TimingWheel_t *wheel, uint8_t id, uint8_t due);
+void TimingWheelSchedule(TimingWheel_t *wheel, uint8_t id, uint8_t delay);
+void TimingWheelTick(TimingWheel_t *wheel);
+uint8_t TimingWheelPop(TimingWheel_t *wheel);
+
+#endif
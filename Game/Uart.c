@@ -5,14 +5,20 @@
 #include "Uart.h"
 
 #define BAUD_REG ((F_CPU / (8 * BAUD)) - 1)
-#define BUF_SIZE 128
+
+/*
+ * Output is drawn into the transmit buffer as fast as the link drains it.
+ * Input is only key presses and short replies from the terminal.
+ */
+#define TX_BUF_SIZE 128
+#define RX_BUF_SIZE 64
 
 /* Tx and Rx Buffers **********************************************************/
 
 volatile CircularBuffer_t rxBuf;
-uint8_t rxData[BUF_SIZE];
+uint8_t rxData[RX_BUF_SIZE];
 volatile CircularBuffer_t txBuf;
-uint8_t txData[BUF_SIZE];
+uint8_t txData[TX_BUF_SIZE];
 
 /* UART Hardware Initialization ***********************************************/
 
@@ -26,9 +32,9 @@ void UartInit(void)
     UBRR0H = (BAUD_REG >> 8);
     UBRR0L = (BAUD_REG);
     
-    rxBuf.Size = BUF_SIZE;
+    rxBuf.Size = RX_BUF_SIZE;
     rxBuf.Buf = rxData;
-    txBuf.Size = BUF_SIZE;
+    txBuf.Size = TX_BUF_SIZE;
     txBuf.Buf = txData;
     
     EnableInterrupts(TRUE);
@@ -62,6 +68,9 @@ void UartPrintP(const char *str, uint8_t len)
 
 bool transmitting;
 
+// Bytes handed to the hardware, wrapping, to measure the link's throughput
+uint16_t uartBytesSent;
+
 /*
  * Sends a byte down the UART
  */
@@ -72,6 +81,7 @@ void UartTransmitByte(uint8_t b)
     if(!transmitting)
     {
         transmitting = TRUE;
+        uartBytesSent++;
         EnableInterrupts(TRUE);
         UDR0 = b;
     }
@@ -88,6 +98,31 @@ void UartTransmitByte(uint8_t b)
     }
 }
 
+/*
+ * Returns how many bytes can be sent without waiting for the buffer to drain.
+ */
+uint8_t UartTransmitSpace()
+{
+    bool interruptsState = DisableInterrupts();
+    uint8_t space = txBuf.Size - txBuf.Count;
+    EnableInterrupts(interruptsState);
+    
+    return space;
+}
+
+/*
+ * Returns the number of bytes sent so far. The count wraps so only the
+ * difference between two calls is meaningful.
+ */
+uint16_t UartBytesSent()
+{
+    bool interruptsState = DisableInterrupts();
+    uint16_t bytes = uartBytesSent;
+    EnableInterrupts(interruptsState);
+    
+    return bytes;
+}
+
 /*
  * UART transmit complete interrupt handler
  */
@@ -95,6 +130,7 @@ void __attribute__((signal)) USART_TX_vect(void)
 {
     if(!CircularBufferIsEmpty(&txBuf))
     {
+        uartBytesSent++;
         UDR0 = CircularBufferRead(&txBuf);
     }
     else
@@ -137,10 +173,17 @@ uint8_t UartBytesToReceive()
 }
 
 /*
- * UART receive complete interrupt handler
+ * UART receive complete interrupt handler. Bytes that arrive while the
+ * buffer is full are dropped, as overwriting the oldest would cut the start
+ * off a sequence that is already being parsed.
  */
 void __attribute__((signal)) USART_RX_vect(void)
 {
-    CircularBufferWrite(&rxBuf, UDR0);
+    uint8_t b = UDR0;
+
+    if(!CircularBufferIsFull(&rxBuf))
+    {
+        CircularBufferWrite(&rxBuf, b);
+    }
 }
 
@@ -22,6 +22,8 @@
 void UartInit(void);
 
 void UartTransmitByte(uint8_t b);
+uint8_t UartTransmitSpace();
+uint16_t UartBytesSent();
 
 uint8_t UartReceiveByte(void);
 uint8_t UartBytesToReceive();
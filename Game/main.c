@@ -13,23 +13,48 @@
 
 #include "Uart.h"
 #include "Rand.h"
+#include "Arena.h"
 #include "Game.h"
 
 int main(void)
 {
     UartInit();
     RandInit();
+    GameInit();
     
     TerminalUseAlternateBuffer();
+    TerminalProbe();
+
+    // Replies are parsed with the rest of the input
+    for(uint8_t i = 0; i < TERMINAL_PROBE_MS && TerminalProbing(); i++)
+    {
+        GameParseInput();
+        _delay_ms(1);
+    }
+
+    TerminalEndProbe();
 
     TCCR1B = (1 << CS12) | (1 << CS10);
+
+    uint16_t frameStart = 0;
     
     while(1)
     {
+        ArenaReset();
         TCCR1B = (1 << CS12) | (1 << CS10);
         
         GameParseInput();
-        GameRender();
+
+        if((uint16_t)(TCNT1 - frameStart) >= FRAME_TICKS
+            && !UartBytesToReceive())
+        {
+            GameRender();
+            frameStart = TCNT1;
+        }
+        else
+        {
+            GameRenderPending();
+        }
         
         TCCR1B &= ~((1 << CS12) | (1 << CS10));
 
@@ -37,10 +62,12 @@ int main(void)
         if(countValue > 600)
         {
             GameStep();
-            TerminalRequestSize();
+            GameUpdateProfile();
+            TerminalPollSize();
             
             TCNT1H = 0;
             TCNT1L = 0;
+            frameStart = 0;
         }
     }
     
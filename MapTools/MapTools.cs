@@ -1,10 +1,55 @@
 using System;
+using System.Collections.Generic;
 using System.IO;
 
 namespace TheResistorNetwork.ETD
 {
     public static class MapTools 
     {
+		// Columns in a chunk of an encoded row
+		const int ChunkWidth = 16;
+
+		// Returns the TileType_t of a map character
+		static int TileType(char c)
+		{
+			switch (c)
+			{
+				case '#':
+					return 0x01;
+				case '~':
+					return 0x02;
+				case '.':
+					return 0x03;
+				default:
+					return 0x00;
+			}
+		}
+
+		// Encodes a run of map characters as one byte per run of a tile,
+		// holding the tile in the low two bits and the length less one
+		// above them. The game draws each run with the style and character
+		// of its tile.
+		static List<int> EncodeChunk(string tiles)
+		{
+			var chunk = new List<int>();
+			var x = 0;
+
+			while (x < tiles.Length)
+			{
+				var count = 1;
+
+				while (x + count < tiles.Length && tiles[x + count] == tiles[x])
+				{
+					count++;
+				}
+
+				chunk.Add(TileType(tiles[x]) | ((count - 1) << 2));
+				x += count;
+			}
+
+			return chunk;
+		}
+
         public static void Main(string[] args)
         {
 			/*
@@ -13,7 +58,7 @@ namespace TheResistorNetwork.ETD
             
             if(args.Length < 1)
             {
-                Console.WriteLine("Usage: maptools.exe mapfile");
+                Console.WriteLine("Usage: maptools.exe mapfile basex basey");
                 return;
             }
              */
@@ -21,35 +66,43 @@ namespace TheResistorNetwork.ETD
 			Console.WriteLine("const uint8_t mapTiles[] PROGMEM = {");
 
             var filename = args[0];
+			var baseX = int.Parse(args[1]);
+			var baseY = int.Parse(args[2]);
+			var rows = new List<string>();
+			var rowWalkable = new List<int>();
+			var mapWidth = 0;
+
 			using(var file = File.OpenText(filename))
             {
                 string line;
 				var tileNum = 0;
 				var tileVal = 0;
+				var width = -1;
                 
                 while((line = file.ReadLine()) != null)
                 {
-					foreach (var c in line.ToCharArray())
-					{
-						byte tile = 0;
+					if (width < 0) {
+						width = line.Length;
+						mapWidth = width;
+					}
+
+					if (line.Length == width) {
+						var walkable = 0;
 
-						switch (c)
+						foreach (var c in line.ToCharArray())
 						{
-							case '#':
-								tile = 0x01;
-								break;
-							case '~':
-								tile = 0x02;
-								break;
-							case '.':
-								tile = 0x03;
-								break;
-							default:
-								tile = 0x00;
-								break;
+							if (c != '#') {
+								walkable++;
+							}
 						}
 
-						tileVal |= (tile << (tileNum * 2));
+						rowWalkable.Add (walkable);
+						rows.Add (line);
+					}
+
+					foreach (var c in line.ToCharArray())
+					{
+						tileVal |= (TileType(c) << (tileNum * 2));
 
 						if (++tileNum > 3) {
 							tileNum = 0;
@@ -61,6 +114,144 @@ namespace TheResistorNetwork.ETD
 
 				Console.WriteLine("};");
             }
+
+			// Number of walkable tiles before each row, used to select a
+			// uniformly random walkable tile without rejection sampling.
+			Console.WriteLine("const uint16_t mapWalkableRank[] PROGMEM = {");
+
+			var rank = 0;
+			foreach (var walkable in rowWalkable)
+			{
+				Console.WriteLine ("{0},", rank);
+				rank += walkable;
+			}
+
+			Console.WriteLine ("{0},", rank);
+			Console.WriteLine("};");
+
+			// One bit per tile, set for tiles on the edge of the map. Cells
+			// without the bit can step in any direction without a bounds check.
+			Console.WriteLine("const uint8_t mapEdgeCells[] PROGMEM = {");
+
+			var height = rowWalkable.Count;
+			var edgeVal = 0;
+			var edgeNum = 0;
+
+			for (var y = 0; y < height; y++)
+			{
+				for (var x = 0; x < mapWidth; x++)
+				{
+					if (x == 0 || y == 0 || x == mapWidth - 1 || y == height - 1) {
+						edgeVal |= (1 << edgeNum);
+					}
+
+					if (++edgeNum > 7) {
+						edgeNum = 0;
+						Console.WriteLine ("0x{0},", edgeVal.ToString ("X2"));
+						edgeVal = 0;
+					}
+				}
+			}
+
+			if (edgeNum > 0) {
+				Console.WriteLine ("0x{0},", edgeVal.ToString ("X2"));
+			}
+
+			Console.WriteLine("};");
+
+			// Walking distance from each tile to the base over the terrain,
+			// clamped to 255. Unreachable tiles are 255.
+			Console.WriteLine("const uint8_t mapBaseDistance[] PROGMEM = {");
+
+			var distance = new int[mapWidth * height];
+			for (var i = 0; i < distance.Length; i++)
+			{
+				distance[i] = 255;
+			}
+
+			var queue = new Queue<int>();
+			distance[baseY * mapWidth + baseX] = 0;
+			queue.Enqueue(baseY * mapWidth + baseX);
+
+			int[] dx = { 0, 1, 0, -1 };
+			int[] dy = { -1, 0, 1, 0 };
+
+			while (queue.Count > 0)
+			{
+				var cell = queue.Dequeue();
+				var x = cell % mapWidth;
+				var y = cell / mapWidth;
+
+				if (distance[cell] >= 254) {
+					continue;
+				}
+
+				for (var d = 0; d < 4; d++)
+				{
+					var nx = x + dx[d];
+					var ny = y + dy[d];
+
+					if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= height) {
+						continue;
+					}
+
+					var next = ny * mapWidth + nx;
+					// Stone is only crossed when walking out of the stone
+					// around the base, as the base sits on a mountain.
+					var passable = rows[ny][nx] != '#' || rows[y][x] == '#';
+
+					if (passable && distance[next] == 255) {
+						distance[next] = distance[cell] + 1;
+						queue.Enqueue(next);
+					}
+				}
+			}
+
+			foreach (var value in distance)
+			{
+				Console.WriteLine ("{0},", value);
+			}
+
+			Console.WriteLine("};");
+
+			// Each row of terrain as runs of a tile, in chunks of ChunkWidth
+			// columns that can be drawn on their own. The offset of each
+			// chunk is followed by the end of the last one. Only built with
+			// MAP_CHUNKS.
+			Console.WriteLine("#ifdef MAP_CHUNKS");
+			Console.WriteLine("#define MAP_CHUNK_WIDTH {0}", ChunkWidth);
+			Console.WriteLine("#define MAP_ROW_CHUNKS {0}",
+				(mapWidth + ChunkWidth - 1) / ChunkWidth);
+			Console.WriteLine("#define MAP_RUN_TILE(run) ((run) & 0x03)");
+			Console.WriteLine("#define MAP_RUN_LENGTH(run) (((run) >> 2) + 1)");
+
+			var runs = new List<int>();
+
+			Console.WriteLine("const uint16_t mapChunkOffsets[] PROGMEM = {");
+
+			foreach (var row in rows)
+			{
+				for (var x = 0; x < mapWidth; x += ChunkWidth)
+				{
+					var end = Math.Min(x + ChunkWidth, mapWidth);
+
+					Console.WriteLine ("{0},", runs.Count);
+					runs.AddRange(EncodeChunk(row.Substring(x, end - x)));
+				}
+			}
+
+			Console.WriteLine ("{0},", runs.Count);
+			Console.WriteLine("};");
+
+			Console.WriteLine("const uint8_t mapChunkRuns[] PROGMEM = {");
+
+			foreach (var run in runs)
+			{
+				Console.WriteLine ("0x{0},", run.ToString ("X2"));
+			}
+
+			Console.WriteLine("};");
+			Console.WriteLine("#endif");
         }
     }
 }